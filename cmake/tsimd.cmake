@@ -22,6 +22,8 @@
 ## DEALINGS IN THE SOFTWARE.                                                  ##
 ## ========================================================================== ##
 
+include(CMakeParseArguments)
+
 ## CMAKE_BUILD_TYPE setup macro ##
 
 macro(tsimd_setup_build_type)
@@ -79,3 +81,90 @@ macro(tsimd_configure_compiler)
 endmacro()
 
 include(clang-format)
+
+## Multi-ISA library function ##
+
+# NOTE: captured here, as CMAKE_CURRENT_LIST_DIR is the caller's directory when
+#       the function below runs
+set(TSIMD_CMAKE_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+# tsimd_add_multi_isa_library(<name>
+#                             ISAS <SCALAR|SSE4|AVX|AVX2|AVX512KNL|AVX512SKX>...
+#                             SOURCES <source>...)
+#
+# Compiles SOURCES once per ISA (using the FLAGS_<ISA> sets from
+# cmake/<compiler>.cmake) into a single static library <name>. Each version is
+# compiled with TSIMD_ISA_NAMESPACE defined to '<name>_<isa>', and the
+# generated header '<name>_dispatch.h' provides the macros to declare those
+# kernels and bind them with tsimd::cpu::dispatcher<>.
+function(tsimd_add_multi_isa_library name)
+  cmake_parse_arguments(TSIMD_MI "" "" "ISAS;SOURCES" ${ARGN})
+
+  if (NOT TSIMD_MI_ISAS OR NOT TSIMD_MI_SOURCES)
+    message(FATAL_ERROR
+            "tsimd_add_multi_isa_library(${name}) needs both ISAS and SOURCES")
+  endif()
+
+  string(TOUPPER ${name} TSIMD_MI_PREFIX)
+  string(MAKE_C_IDENTIFIER ${TSIMD_MI_PREFIX} TSIMD_MI_PREFIX)
+  set(TSIMD_MI_NAME ${name})
+  set(TSIMD_MI_DECLARATIONS "")
+  set(TSIMD_MI_ENTRIES "")
+  set(TSIMD_MI_OBJECTS "")
+  unset(TSIMD_MI_FIRST_NS)
+
+  foreach(isa ${TSIMD_MI_ISAS})
+    string(TOUPPER ${isa} isa)
+
+    if (isa STREQUAL "SCALAR")
+      set(isa_enum scalar)
+      set(isa_flags "")
+    elseif (isa STREQUAL "SSE4")
+      set(isa_enum sse42)
+      set(isa_flags ${FLAGS_SSE42})
+    elseif (DEFINED FLAGS_${isa})
+      string(TOLOWER ${isa} isa_enum)
+      set(isa_flags ${FLAGS_${isa}})
+    else()
+      message(FATAL_ERROR "tsimd_add_multi_isa_library(${name}): ISA '${isa}' "
+                          "is not supported by ${CMAKE_CXX_COMPILER_ID}")
+    endif()
+
+    # NOTE: -march=native (TSIMD_BENCHMARK_ISA=NATIVE) is part of the global
+    #       CMAKE_CXX_FLAGS, so reset the target architecture before adding
+    #       each ISA's own flags
+    if (CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang")
+      set(isa_flags "-march=x86-64 ${isa_flags}")
+    endif()
+
+    set(isa_ns ${name}_${isa_enum})
+    string(MAKE_C_IDENTIFIER ${isa_ns} isa_ns)
+
+    add_library(${isa_ns} OBJECT ${TSIMD_MI_SOURCES})
+    set_target_properties(${isa_ns} PROPERTIES
+      COMPILE_FLAGS "${isa_flags}"
+      COMPILE_DEFINITIONS "TSIMD_ISA_NAMESPACE=${isa_ns}"
+      POSITION_INDEPENDENT_CODE ON
+    )
+    target_include_directories(${isa_ns} PRIVATE ${CMAKE_CURRENT_BINARY_DIR})
+
+    list(APPEND TSIMD_MI_OBJECTS $<TARGET_OBJECTS:${isa_ns}>)
+
+    if (NOT TSIMD_MI_FIRST_NS)
+      set(TSIMD_MI_FIRST_NS ${isa_ns})
+    endif()
+
+    # one line of each generated macro per ISA (note the line continuations)
+    set(declaration "  namespace ${isa_ns} { RET FCN ARGS; } \\\n")
+    set(entry "    {tsimd::cpu::isa::${isa_enum}, &${isa_ns}::FCN}, \\\n")
+    set(TSIMD_MI_DECLARATIONS "${TSIMD_MI_DECLARATIONS}${declaration}")
+    set(TSIMD_MI_ENTRIES "${TSIMD_MI_ENTRIES}${entry}")
+  endforeach()
+
+  configure_file(${TSIMD_CMAKE_DIR}/tsimd_multi_isa.h.in
+                 ${CMAKE_CURRENT_BINARY_DIR}/${name}_dispatch.h @ONLY)
+
+  add_library(${name} STATIC ${TSIMD_MI_OBJECTS})
+  set_target_properties(${name} PROPERTIES LINKER_LANGUAGE CXX)
+  target_include_directories(${name} PUBLIC ${CMAKE_CURRENT_BINARY_DIR})
+endfunction()
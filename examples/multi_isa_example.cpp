@@ -0,0 +1,48 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#include <iostream>
+#include <vector>
+
+#include "multi_isa_kernels.h"
+
+int main()
+{
+  static const auto saxpy = MULTI_ISA_KERNELS_DISPATCHER(saxpy);
+
+  std::cout << "host ISA: " << tsimd::cpu::name(tsimd::cpu::target_isa())
+            << std::endl;
+  std::cout << "saxpy() ISA: " << tsimd::cpu::name(saxpy.chosen_isa())
+            << std::endl;
+
+  const int n = 1003;
+  std::vector<float> x(n, 1.f), y(n, 2.f), out(n, 0.f);
+
+  saxpy(2.f, n, x.data(), y.data(), out.data());
+
+  std::cout << "out[0] == " << out[0] << ", out[" << n - 1
+            << "] == " << out[n - 1] << std::endl;
+
+  return 0;
+}
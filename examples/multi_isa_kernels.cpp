@@ -0,0 +1,50 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#include "tsimd/tsimd.h"
+
+#include "multi_isa_kernels.h"
+
+// NOTE: this file is compiled once per ISA, where 'vfloat' is the native
+//       width of each one
+
+namespace TSIMD_ISA_NAMESPACE {
+
+  void saxpy(float a, int n, float x[], float y[], float out[])
+  {
+    using namespace tsimd;
+
+    int i = 0;
+
+    for (; i + vfloat::static_size <= n; i += vfloat::static_size) {
+      const vfloat xi = load_unaligned<vfloat>(x + i);
+      const vfloat yi = load_unaligned<vfloat>(y + i);
+      store_unaligned(a * xi + yi, out + i);
+    }
+
+    for (; i < n; ++i)
+      out[i] = a * x[i] + y[i];
+  }
+
+}  // namespace TSIMD_ISA_NAMESPACE
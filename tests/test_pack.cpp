@@ -27,8 +27,12 @@
 #include "tsimd/tsimd.h"
 
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <numeric>
 #include <random>
+#include <type_traits>
+#include <vector>
 
 #ifndef TEST_WIDTH
 #define TEST_WIDTH 1
@@ -135,6 +139,33 @@ TEST_CASE("cast construction", "[member_functions]")
   REQUIRE(tsimd::all(v16 == test16));
 }
 
+TEST_CASE("element conversions", "[member_functions]")
+{
+  using vfloat32 = tsimd::pack<float, TEST_WIDTH>;
+  using vfloat64 = tsimd::pack<double, TEST_WIDTH>;
+  using vint32   = tsimd::pack<int, TEST_WIDTH>;
+  using vint64   = tsimd::pack<long long, TEST_WIDTH>;
+
+  vfloat v;
+  std::iota(v.begin(), v.end(), float_type(-2.5));
+
+  auto truncated = tsimd::convert_elements_to<int_type>(v);
+  auto rounded   = tsimd::round_elements_to<int_type>(v);
+
+  for (int i = 0; i < vfloat::static_size; ++i) {
+    REQUIRE(truncated[i] == static_cast<int_type>(v[i]));
+    REQUIRE(rounded[i] == static_cast<int_type>(std::nearbyint(v[i])));
+  }
+
+  vint32 i32(truncated);
+  REQUIRE(tsimd::all(vint64(i32) == vint64(truncated)));
+  REQUIRE(tsimd::all(vint32(vint64(i32)) == i32));
+  REQUIRE(tsimd::all(vfloat32(i32) == vfloat32(vfloat64(i32))));
+  REQUIRE(tsimd::all(vint32(vfloat64(vfloat32(v))) == i32));
+  REQUIRE(tsimd::all(vint64(vfloat32(i32)) == vint64(i32)));
+  REQUIRE(tsimd::all(vfloat32(vint64(i32)) == vfloat32(i32)));
+}
+
 // pack<> arithmetic operators ////////////////////////////////////////////////
 
 TEST_CASE("binary operator+()", "[arithmetic_operators]")
@@ -204,6 +235,22 @@ TEST_CASE("binary operator*()", "[arithmetic_operators]")
   REQUIRE(value);
 }
 
+TEST_CASE("binary operator*() on wide integers", "[arithmetic_operators]")
+{
+  // NOTE: exercises the upper halves of 64-bit lanes when TEST_DOUBLE_PRECISION
+  const int_type big = std::numeric_limits<int_type>::max() / 3;
+
+  vint v1(big), v2(-3);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    v1[i] -= i;
+
+  const vint result = v1 * v2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(result[i] == (big - i) * -3);
+}
+
 TEST_CASE("binary operator*=()", "[arithmetic_operators]")
 {
   vint v1(1), v2(2);
@@ -265,6 +312,46 @@ TEST_CASE("binary operator%=()", "[arithmetic_operators]")
   REQUIRE(tsimd::all(v2 == vint(1)));
 }
 
+TEST_CASE("divider<>", "[arithmetic_operators]")
+{
+  const std::array<int_type, 8> divisors = {
+      {1, -1, 2, 7, -10, 641, 65536, std::numeric_limits<int_type>::max()}};
+
+  vint v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    v[i] = (i % 2 ? -1 : 1) * int_type(123456789 + 1000003 * i);
+  v[0] = std::numeric_limits<int_type>::max();
+
+  for (int_type d : divisors) {
+    const tsimd::divider<int_type> div(d);
+
+    const vint q = v / div;
+    const vint r = v % div;
+
+    for (int i = 0; i < TEST_WIDTH; ++i) {
+      REQUIRE(q[i] == v[i] / d);
+      REQUIRE(r[i] == v[i] % d);
+    }
+  }
+
+#if !TEST_DOUBLE_PRECISION
+  const tsimd::divider<int> div(-37);
+
+  vint small;
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    small[i] = (i % 2 ? -1 : 1) * (16777215 - 4099 * i);
+
+  const vint q = tsimd::fast_divide(small, div);
+  const vint r = tsimd::fast_modulo(small, div);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(q[i] == small[i] / -37);
+    REQUIRE(r[i] == small[i] % -37);
+  }
+#endif
+}
+
 // pack<> bitwise operators ///////////////////////////////////////////////////
 
 TEST_CASE("binary operator&()", "[bitwise_operators]")
@@ -303,6 +390,41 @@ TEST_CASE("binary operator>>()", "[bitwise_operators]")
   REQUIRE(tsimd::all((4 >> v1) == vint(1)));
 }
 
+TEST_CASE("per-lane, uniform and compile-time shifts", "[bitwise_operators]")
+{
+  using uint_type = typename std::make_unsigned<int_type>::type;
+
+  vint v;
+  vint n;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    v[i] = -int_type(1000 + 37 * i);
+    n[i] = i % 8;
+  }
+
+  const int k = int(n[TEST_WIDTH - 1]) + 1;
+
+  const vint l   = v << n;
+  const vint r   = v >> n;
+  const vint ul  = v << k;
+  const vint ur  = v >> k;
+  const vint sl  = tsimd::shift_left<3>(v);
+  const vint sr  = tsimd::shift_right<3>(v);
+  const vint sra = tsimd::shift_right_arithmetic<5>(v);
+  const vint srl = tsimd::shift_right_logical<5>(v);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(l[i] == int_type(uint_type(v[i]) << n[i]));
+    REQUIRE(r[i] == (v[i] >> n[i]));
+    REQUIRE(ul[i] == int_type(uint_type(v[i]) << k));
+    REQUIRE(ur[i] == (v[i] >> k));
+    REQUIRE(sl[i] == int_type(uint_type(v[i]) << 3));
+    REQUIRE(sr[i] == (v[i] >> 3));
+    REQUIRE(sra[i] == (v[i] >> 5));
+    REQUIRE(srl[i] == int_type(uint_type(v[i]) >> 5));
+  }
+}
+
 TEST_CASE("binary operator^()", "[bitwise_operators]")
 {
   vint v1(1);
@@ -389,6 +511,166 @@ TEST_CASE("binary operator>=()", "[logic_operators]")
   REQUIRE(tsimd::all(v1 >= 2));
 }
 
+TEST_CASE("per-lane compares and select()", "[logic_operators]")
+{
+  vint vi1, vi2;
+  vfloat vf1, vf2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    vi1[i] = (i % 2) ? -i : i;
+    vi2[i] = 1 - i;
+    vf1[i] = float_type(vi1[i]) * 0.5f;
+    vf2[i] = float_type(vi2[i]) * 0.5f;
+  }
+
+  const auto ilt = vi1 < vi2, ile = vi1 <= vi2, igt = vi1 > vi2,
+             ige = vi1 >= vi2, ieq = vi1 == vi2;
+  const auto flt = vf1 < vf2, fle = vf1 <= vf2, fgt = vf1 > vf2,
+             fge = vf1 >= vf2, feq = vf1 == vf2;
+
+  const vint imin = tsimd::min(vi1, vi2), imax = tsimd::max(vi1, vi2);
+  const vint isel = tsimd::select(igt, vi1, vi2);
+  const vfloat fsel = tsimd::select(fgt, vf1, vf2);
+  const vint iabs = tsimd::abs(vi1);
+  const vfloat fab = tsimd::abs(vf1);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(bool(ilt[i]) == (vi1[i] < vi2[i]));
+    REQUIRE(bool(ile[i]) == (vi1[i] <= vi2[i]));
+    REQUIRE(bool(igt[i]) == (vi1[i] > vi2[i]));
+    REQUIRE(bool(ige[i]) == (vi1[i] >= vi2[i]));
+    REQUIRE(bool(ieq[i]) == (vi1[i] == vi2[i]));
+    REQUIRE(bool(flt[i]) == (vf1[i] < vf2[i]));
+    REQUIRE(bool(fle[i]) == (vf1[i] <= vf2[i]));
+    REQUIRE(bool(fgt[i]) == (vf1[i] > vf2[i]));
+    REQUIRE(bool(fge[i]) == (vf1[i] >= vf2[i]));
+    REQUIRE(bool(feq[i]) == (vf1[i] == vf2[i]));
+    REQUIRE(imin[i] == std::min(vi1[i], vi2[i]));
+    REQUIRE(imax[i] == std::max(vi1[i], vi2[i]));
+    REQUIRE(isel[i] == std::max(vi1[i], vi2[i]));
+    REQUIRE(fsel[i] == std::max(vf1[i], vf2[i]));
+    REQUIRE(iabs[i] == std::abs(vi1[i]));
+    REQUIRE(fab[i] == std::abs(vf1[i]));
+  }
+
+  REQUIRE(tsimd::all(ieq == !(ilt | igt)));
+}
+
+TEST_CASE("unsigned int packs", "[logic_operators]")
+{
+  using vuint = tsimd::pack<unsigned int, TEST_WIDTH>;
+
+  alignas(64) std::array<unsigned int, TEST_WIDTH> data;
+  vuint v1, v2;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    data[i] = 0xFFFFFFFFu - unsigned(i) * 0x11111111u;
+    v1[i]   = (i % 2) ? 0x80000000u + unsigned(i) : unsigned(i);
+    v2[i]   = 0x7FFFFFFFu + unsigned(i);
+  }
+
+  const auto lt = v1 < v2, le = v1 <= v2, gt = v1 > v2, ge = v1 >= v2;
+  const vuint vmin = tsimd::min(v1, v2), vmax = tsimd::max(v1, v2);
+  const vuint sum = v1 + v2, shr = v1 >> vuint(31);
+
+  const vuint loaded = tsimd::load<vuint>(data.data());
+  const vuint gathered =
+      tsimd::gather<vuint>(data.data(), tsimd::pack<int, TEST_WIDTH>(0));
+  const auto asfloat = tsimd::convert_elements_to<float>(loaded);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(bool(lt[i]) == (v1[i] < v2[i]));
+    REQUIRE(bool(le[i]) == (v1[i] <= v2[i]));
+    REQUIRE(bool(gt[i]) == (v1[i] > v2[i]));
+    REQUIRE(bool(ge[i]) == (v1[i] >= v2[i]));
+    REQUIRE(vmin[i] == std::min(v1[i], v2[i]));
+    REQUIRE(vmax[i] == std::max(v1[i], v2[i]));
+    REQUIRE(sum[i] == v1[i] + v2[i]);
+    REQUIRE(shr[i] == v1[i] >> 31);
+    REQUIRE(loaded[i] == data[i]);
+    REQUIRE(gathered[i] == data[0]);
+    REQUIRE(asfloat[i] == float(data[i]));
+  }
+
+  REQUIRE(tsimd::reduce_max(loaded) == 0xFFFFFFFFu);
+  REQUIRE(tsimd::convert_elements_to<unsigned int>(
+              tsimd::pack<float, TEST_WIDTH>(4e9f))[0] == 4000000000u);
+}
+
+TEST_CASE("8-bit and 16-bit packs", "[logic_operators]")
+{
+  constexpr int CW = TEST_WIDTH >= 16 ? 64 : TEST_WIDTH * 4;
+  constexpr int SW = TEST_WIDTH == 1 ? 4 : TEST_WIDTH * 2;
+
+  using vchar   = tsimd::pack<int8_t, CW>;
+  using vuchar  = tsimd::pack<uint8_t, CW>;
+  using vshort  = tsimd::pack<int16_t, SW>;
+  using vushort = tsimd::pack<uint16_t, SW>;
+
+  alignas(64) std::array<uint8_t, CW> bytes;
+  alignas(64) std::array<int16_t, SW> words;
+  vchar c1, c2;
+  vushort s1, s2;
+  tsimd::pack<int8_t, 16> table;
+
+  for (int i = 0; i < 16; ++i)
+    table[i] = int8_t(3 * i - 20);
+
+  for (int i = 0; i < CW; ++i) {
+    bytes[i] = uint8_t(i * 7);
+    c1[i]    = int8_t(i * 11 - 100);
+    c2[i]    = int8_t(90 - i * 5);
+  }
+
+  for (int i = 0; i < SW; ++i) {
+    words[i] = int16_t(i * 3001 - 30000);
+    s1[i]    = uint16_t(i * 9001);
+    s2[i]    = uint16_t(60000 - i * 1000);
+  }
+
+  const auto gt = c1 > c2;
+  const auto lt = s1 < s2;
+  const vchar sadd = tsimd::saturating_add(c1, c2);
+  const vchar ssub = tsimd::saturating_sub(c1, c2);
+  const vchar cmax = tsimd::max(c1, c2);
+  const vchar avg  = tsimd::average(c1, c2);
+  const vushort usub = tsimd::saturating_sub(s1, s2);
+  const vushort prod = s1 * s2;
+
+  const vuchar loaded = tsimd::load<vuchar>(bytes.data());
+  const vchar looked  = tsimd::lookup(table, loaded & vuchar(31));
+  const vshort wloaded = tsimd::load<vshort>(words.data());
+  const auto widened   = tsimd::convert_elements_to<int>(
+      tsimd::load<tsimd::pack<int16_t, TEST_WIDTH>>(words.data()));
+  const auto narrowed = tsimd::convert_elements_to<int16_t>(widened * 3);
+
+  for (int i = 0; i < CW; ++i) {
+    const int a = c1[i], b = c2[i], idx = bytes[i] & 31;
+    REQUIRE(bool(gt[i]) == (a > b));
+    REQUIRE(sadd[i] == std::max(-128, std::min(127, a + b)));
+    REQUIRE(ssub[i] == std::max(-128, std::min(127, a - b)));
+    REQUIRE(cmax[i] == std::max(a, b));
+    REQUIRE(avg[i] == (a + b + 1) >> 1);
+    REQUIRE(loaded[i] == bytes[i]);
+    REQUIRE(looked[i] == (idx < 16 ? table[idx] : 0));
+  }
+
+  for (int i = 0; i < SW; ++i) {
+    REQUIRE(bool(lt[i]) == (s1[i] < s2[i]));
+    REQUIRE(usub[i] == std::max(0, int(s1[i]) - int(s2[i])));
+    REQUIRE(prod[i] == uint16_t(unsigned(s1[i]) * unsigned(s2[i])));
+    REQUIRE(wloaded[i] == words[i]);
+  }
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(widened[i] == int(words[i]));
+    REQUIRE(narrowed[i] == int16_t(int(words[i]) * 3));
+  }
+
+  tsimd::store(c1, bytes.data());
+  REQUIRE(tsimd::all(tsimd::load<vchar>(bytes.data()) == c1));
+}
+
 TEST_CASE("unary operator!()", "[logic_operators]")
 {
   vbool v(true);
@@ -450,15 +732,17 @@ TEST_CASE("max()", "[math_functions]")
 TEST_CASE("rcp()", "[math_functions]")
 {
   vfloat v1(4.f);
+  REQUIRE(tsimd::all(tsimd::exact_rcp(v1) == 0.25f));
   v1 = tsimd::rcp(v1);
-  REQUIRE(tsimd::all(tsimd::near_equal(v1, vfloat(0.25f), float_type(1e-3f))));
+  REQUIRE(tsimd::all(tsimd::near_equal(v1, vfloat(0.25f), float_type(1e-6f))));
 }
 
 TEST_CASE("rsqrt()", "[math_functions]")
 {
   vfloat v1(4.f);
+  REQUIRE(tsimd::all(tsimd::exact_rsqrt(v1) == 0.5f));
   v1 = tsimd::rsqrt(v1);
-  REQUIRE(tsimd::all(tsimd::near_equal(v1, vfloat(0.5f), float_type(1e-3f))));
+  REQUIRE(tsimd::all(tsimd::near_equal(v1, vfloat(0.5f), float_type(1e-6f))));
 }
 
 TEST_CASE("sqrt()", "[math_functions]")
@@ -507,6 +791,108 @@ TEST_CASE("pow()", "[math_functions]")
   REQUIRE(tsimd::all(tsimd::near_equal(tsimd::pow(v, 2.5f), pow(2.f, 2.5f))));
 }
 
+TEST_CASE("fma()/fms()/fnma()/fnms()", "[math_functions]")
+{
+  vfloat a, b, c;
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    a[i] = float_type(0.5) + i;
+    b[i] = float_type(2) - i;
+    c[i] = float_type(3) * i;
+  }
+
+  const auto vfma  = tsimd::fma(a, b, c);
+  const auto vfms  = tsimd::fms(a, b, c);
+  const auto vfnma = tsimd::fnma(a, b, c);
+  const auto vfnms = tsimd::fnms(a, b, c);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(vfma[i] == a[i] * b[i] + c[i]);
+    REQUIRE(vfms[i] == a[i] * b[i] - c[i]);
+    REQUIRE(vfnma[i] == c[i] - a[i] * b[i]);
+    REQUIRE(vfnms[i] == -(a[i] * b[i]) - c[i]);
+  }
+
+  REQUIRE(tsimd::all(tsimd::fma(a, b, 1.f) == a * b + 1.f));
+}
+
+TEST_CASE("horner()/estrin()", "[math_functions]")
+{
+  vfloat x;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    x[i] = float_type(-1) + float_type(0.25) * i;
+
+  const auto h = tsimd::horner(x, 1, 2.f, 3.0, -4, 0.5f, 6);
+  const auto e = tsimd::estrin(x, 1, 2.f, 3.0, -4, 0.5f, 6);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    const float_type v = x[i];
+    const float_type expected =
+        1 + v * (2 + v * (3 + v * (-4 + v * (float_type(0.5) + v * 6))));
+    const float_type tolerance =
+        float_type(1e-5) * std::max(float_type(1), std::abs(expected));
+    REQUIRE(std::abs(h[i] - expected) <= tolerance);
+    REQUIRE(std::abs(e[i] - expected) <= tolerance);
+  }
+
+  REQUIRE(tsimd::all(tsimd::horner(x, 3) == 3.f));
+  REQUIRE(tsimd::all(tsimd::estrin(x, 3) == 3.f));
+}
+
+TEST_CASE("transcendentals across lanes", "[math_functions]")
+{
+  const float_type tolerance = TEST_DOUBLE_PRECISION ? 1e-14 : 1e-5;
+
+  auto check = [&](float_type result, float_type expected) {
+    return std::abs(result - expected) <=
+           tolerance * std::max(float_type(1), std::abs(expected));
+  };
+
+  vfloat v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    v[i] = float_type(-3.7) + float_type(1.3) * i;
+
+  const auto vexp = tsimd::exp(v);
+  const auto vsin = tsimd::sin(v);
+  const auto vcos = tsimd::cos(v);
+  const auto vtan = tsimd::tan(v);
+  const auto vlog = tsimd::log(tsimd::abs(v));
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(check(vexp[i], std::exp(v[i])));
+    REQUIRE(check(vsin[i], std::sin(v[i])));
+    REQUIRE(check(vcos[i], std::cos(v[i])));
+    REQUIRE(check(vtan[i], std::tan(v[i])));
+    REQUIRE(check(vlog[i], std::log(std::abs(v[i]))));
+  }
+}
+
+TEST_CASE("fast_*() math variants", "[math_functions]")
+{
+  vfloat v;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    v[i] = float_type(0.3) + float_type(1.7) * i;
+
+  const auto vexp   = tsimd::fast_exp(v);
+  const auto vlog   = tsimd::fast_log(v);
+  const auto vsin   = tsimd::fast_sin(v);
+  const auto vcos   = tsimd::fast_cos(v);
+  const auto vrcp   = tsimd::fast_rcp(v);
+  const auto vrsqrt = tsimd::fast_rsqrt(v);
+
+  for (int i = 0; i < TEST_WIDTH; ++i) {
+    REQUIRE(std::abs(vexp[i] / std::exp(v[i]) - 1) < 1e-3);
+    REQUIRE(std::abs(vlog[i] - std::log(v[i])) < 1e-3);
+    REQUIRE(std::abs(vsin[i] - std::sin(v[i])) < 1e-3);
+    REQUIRE(std::abs(vcos[i] - std::cos(v[i])) < 1e-3);
+    REQUIRE(std::abs(vrcp[i] * v[i] - 1) < 1e-3);
+    REQUIRE(std::abs(vrsqrt[i] * std::sqrt(v[i]) - 1) < 1e-3);
+  }
+}
+
 // pack<> algorithms //////////////////////////////////////////////////////////
 
 TEST_CASE("foreach()", "[algorithms]")
@@ -554,18 +940,77 @@ TEST_CASE("foreach_unique()", "[algorithms]")
   int checker = 0;
   vint v(0);
 
-#if TEST_WIDTH > 1
+#if TEST_WIDTH > 2
   v[0] = 2;
   v[2] = 3;
 
   tsimd::foreach_unique(v, [&](vbool, int_type) { checker++; });
   REQUIRE(checker == 3);
+#elif TEST_WIDTH == 2
+  v[0] = 2;
+
+  tsimd::foreach_unique(v, [&](vbool, int_type) { checker++; });
+  REQUIRE(checker == 2);
 #else
   tsimd::foreach_unique(v, [&](vbool, int_type) { checker++; });
   REQUIRE(checker == 1);
 #endif
 }
 
+TEST_CASE("conflict()", "[algorithms]")
+{
+  vint v;
+  for (int i = 0; i < vint::static_size; ++i)
+    v[i] = i % 3;
+
+  auto c = tsimd::conflict(v);
+
+  for (int i = 0; i < vint::static_size; ++i) {
+    int_type expected = 0;
+    for (int j = i % 3; j < i; j += 3)
+      expected |= int_type(1) << j;
+    REQUIRE(c[i] == expected);
+  }
+
+  int calls = 0;
+  tsimd::foreach_unique(v, [&](vbool m, int_type value) {
+    REQUIRE(value == calls++);
+    for (int i = 0; i < vint::static_size; ++i)
+      REQUIRE(bool(m[i]) == (v[i] == value));
+  });
+  REQUIRE(calls == std::min(3, int(vint::static_size)));
+}
+
+TEST_CASE("to_bitmask()/from_bitmask()/popcount()", "[algorithms]")
+{
+  const int n         = vbool::static_size;
+  const uint64_t all  = n == 64 ? ~uint64_t(0) : (uint64_t(1) << n) - 1;
+  const uint64_t bits = uint64_t(0x9e3779b97f4a7c15) & all;
+
+  vbool m = tsimd::from_bitmask<vbool>(bits);
+
+  int count = 0;
+  for (int i = 0; i < n; ++i) {
+    REQUIRE(bool(m[i]) == bool((bits >> i) & 1));
+    count += (bits >> i) & 1;
+  }
+
+  REQUIRE(tsimd::to_bitmask(m) == bits);
+  REQUIRE(tsimd::popcount(m) == count);
+  REQUIRE(tsimd::to_bitmask(vbool(true)) == all);
+  REQUIRE(tsimd::popcount(vbool(false)) == 0);
+
+  REQUIRE(tsimd::first_active(vbool(false)) == -1);
+  REQUIRE(tsimd::last_active(vbool(false)) == -1);
+  REQUIRE(tsimd::first_active(vbool(true)) == 0);
+  REQUIRE(tsimd::last_active(vbool(true)) == n - 1);
+
+  vbool one(false);
+  one[n - 1] = true;
+  REQUIRE(tsimd::first_active(one) == n - 1);
+  REQUIRE(tsimd::last_active(one) == n - 1);
+}
+
 TEST_CASE("any()", "[algorithms]")
 {
   vbool m(false);
@@ -632,6 +1077,42 @@ TEST_CASE("select()", "[algorithms]")
   }
 }
 
+TEST_CASE("reduce_*()", "[algorithms]")
+{
+  vint v1;
+  std::iota(v1.begin(), v1.end(), 1);
+
+  vfloat v2(v1);
+
+  const int_type n = vint::static_size;
+
+  REQUIRE(tsimd::reduce_add(v1) == n * (n + 1) / 2);
+  REQUIRE(tsimd::reduce_add(v2) == float_type(n * (n + 1) / 2));
+  REQUIRE(tsimd::reduce_min(v2) == 1);
+  REQUIRE(tsimd::reduce_max(v1) == n);
+  REQUIRE(tsimd::reduce_mul(vfloat(2)) == float_type(uint64_t(1) << n));
+  REQUIRE(tsimd::reduce_and(v1) == (n == 1 ? 1 : 0));
+  REQUIRE(tsimd::reduce_or(vint(0x10)) == 0x10);
+
+  vbool m(true);
+  m[0] = false;
+
+  REQUIRE(tsimd::reduce_add(v1, m) == n * (n + 1) / 2 - 1);
+  if (n > 1)
+    REQUIRE(tsimd::reduce_min(v1, m) == 2);
+  REQUIRE(tsimd::reduce_max(v2, vbool(false)) < 0);
+  REQUIRE(tsimd::reduce_mul(v1, m) == tsimd::reduce_mul(v1));
+
+  auto sums = tsimd::reduce_add(v2, v2 * 2, v2 * 3, v2 * 4);
+  for (int i = 0; i < 4; ++i)
+    REQUIRE(sums[i] == (i + 1) * tsimd::reduce_add(v2));
+
+  auto sums8 = tsimd::reduce_add(v1, v1, v1, v1, v1 + 1, v1, v1, v1 + 2);
+  REQUIRE(sums8[0] == tsimd::reduce_add(v1));
+  REQUIRE(sums8[4] == tsimd::reduce_add(v1) + n);
+  REQUIRE(sums8[7] == tsimd::reduce_add(v1) + 2 * n);
+}
+
 TEST_CASE("near_equal()", "[algorithms]")
 {
   vfloat v1(1.f);
@@ -644,6 +1125,154 @@ TEST_CASE("near_equal()", "[algorithms]")
   REQUIRE(tsimd::none(tsimd::near_equal(v1, v2, vfloat::element_t(0.11))));
 }
 
+// pack<> shuffle functions ///////////////////////////////////////////////////
+
+TEST_CASE("permute()/permute2()", "[shuffle_functions]")
+{
+  vfloat v1;
+  std::iota(v1.begin(), v1.end(), 0);
+  vfloat v2 = v1 + vfloat::static_size;
+
+  tsimd::pack<int, TEST_WIDTH> idx;
+  for (int i = 0; i < vfloat::static_size; ++i)
+    idx[i] = (i * 3 + 1) % (2 * vfloat::static_size);
+
+  auto r1 = tsimd::permute(v1, idx);
+  auto r2 = tsimd::permute2(v1, v2, idx);
+
+  for (int i = 0; i < vfloat::static_size; ++i) {
+    REQUIRE(r1[i] == idx[i] % vfloat::static_size);
+    REQUIRE(r2[i] == idx[i]);
+  }
+}
+
+TEST_CASE("shuffle()/shuffle2()", "[shuffle_functions]")
+{
+  vint v1;
+  std::iota(v1.begin(), v1.end(), 0);
+  vint v2 = v1 + vint::static_size;
+
+#if TEST_WIDTH == 1
+  auto r1 = tsimd::shuffle<0>(v1);
+  auto r2 = tsimd::shuffle2<1>(v1, v2);
+  vint e1(0);
+  vint e2(1);
+#elif TEST_WIDTH == 2
+  auto r1 = tsimd::shuffle<1, 0>(v1);
+  auto r2 = tsimd::shuffle2<3, 0>(v1, v2);
+  vint e1(std::array<int_type, 2>{{1, 0}});
+  vint e2(std::array<int_type, 2>{{3, 0}});
+#elif TEST_WIDTH == 4
+  auto r1 = tsimd::shuffle<3, 1, 2, 0>(v1);
+  auto r2 = tsimd::shuffle2<1, 0, 6, 4>(v1, v2);
+  vint e1(3, 1, 2, 0);
+  vint e2(1, 0, 6, 4);
+#elif TEST_WIDTH == 8
+  auto r1 = tsimd::shuffle<1, 0, 3, 2, 5, 4, 7, 6>(v1);
+  auto r2 = tsimd::shuffle2<0, 8, 1, 9, 15, 2, 3, 4>(v1, v2);
+  vint e1(1, 0, 3, 2, 5, 4, 7, 6);
+  vint e2(0, 8, 1, 9, 15, 2, 3, 4);
+#elif TEST_WIDTH == 16
+  auto r1 =
+      tsimd::shuffle<15, 14, 13, 12, 11, 10, 9, 8, 0, 1, 2, 3, 4, 5, 6, 7>(v1);
+  auto r2 = tsimd::
+      shuffle2<0, 16, 1, 17, 2, 18, 3, 19, 31, 30, 4, 5, 6, 7, 8, 9>(v1, v2);
+  vint e1(15, 14, 13, 12, 11, 10, 9, 8, 0, 1, 2, 3, 4, 5, 6, 7);
+  vint e2(0, 16, 1, 17, 2, 18, 3, 19, 31, 30, 4, 5, 6, 7, 8, 9);
+#else
+  auto r1 = tsimd::shuffle<31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+                           20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+                           9, 8, 7, 6, 5, 4, 3, 2, 1, 0>(v1);
+  auto r2 = tsimd::shuffle2<0, 32, 1, 33, 2, 34, 3, 35, 4, 36, 5, 37, 6,
+                            38, 7, 39, 63, 62, 61, 60, 8, 9, 10, 11, 12,
+                            13, 14, 15, 16, 17, 18, 19>(v1, v2);
+  vint e1 = tsimd::reverse(v1);
+  vint e2;
+  for (int i = 0; i < 16; ++i)
+    e2[i] = (i & 1) ? 32 + i / 2 : i / 2;
+  for (int i = 16; i < 20; ++i)
+    e2[i] = 79 - i;
+  for (int i = 20; i < 32; ++i)
+    e2[i] = i - 12;
+#endif
+
+  REQUIRE(tsimd::all(r1 == e1));
+  REQUIRE(tsimd::all(r2 == e2));
+}
+
+TEST_CASE("broadcast()/reverse()/rotate()", "[shuffle_functions]")
+{
+  vfloat v1;
+  std::iota(v1.begin(), v1.end(), 0);
+
+  const int n = vfloat::static_size;
+
+  REQUIRE(tsimd::all(tsimd::broadcast<n - 1>(v1) == float_type(n - 1)));
+
+  auto reversed = tsimd::reverse(v1);
+  auto rotated  = tsimd::rotate<1>(v1);
+  auto back     = tsimd::rotate<-1>(rotated);
+
+  for (int i = 0; i < n; ++i) {
+    REQUIRE(reversed[i] == n - 1 - i);
+    REQUIRE(rotated[i] == (i + 1) % n);
+    REQUIRE(back[i] == i);
+  }
+}
+
+TEST_CASE("interleave_lo()/interleave_hi()", "[shuffle_functions]")
+{
+  vint v1;
+  std::iota(v1.begin(), v1.end(), 0);
+  vint v2 = v1 + 100;
+
+  auto lo = tsimd::interleave_lo(v1, v2);
+  auto hi = tsimd::interleave_hi(v1, v2);
+
+  const int n = vint::static_size;
+
+  for (int k = 0; k < 2 * n; ++k) {
+    const int_type expected = (k & 1) ? v2[k / 2] : v1[k / 2];
+    REQUIRE((k < n ? lo[k] : hi[k - n]) == expected);
+  }
+}
+
+TEST_CASE("compress()/expand()", "[shuffle_functions]")
+{
+  vfloat v1;
+  std::iota(v1.begin(), v1.end(), 1);
+
+  vint sel;
+  std::vector<float_type> active;
+  for (int i = 0; i < vint::static_size; ++i) {
+    sel[i] = (i % 3 != 1);
+    if (sel[i])
+      active.push_back(v1[i]);
+  }
+
+  const auto m = sel != 0;
+  const int n  = active.size();
+
+  auto compressed = tsimd::compress(v1, m);
+
+  std::array<float_type, TEST_WIDTH + 1> packed;
+  packed.fill(-1);
+  REQUIRE(tsimd::compress_store(v1, packed.data(), m) == n);
+  REQUIRE(packed[n] == -1);
+
+  auto expanded = tsimd::expand(compressed, m);
+  auto loaded   = tsimd::expand_load<vfloat>(packed.data(), m);
+
+  for (int i = 0; i < vfloat::static_size; ++i) {
+    REQUIRE(compressed[i] == (i < n ? active[i] : 0));
+    REQUIRE(expanded[i] == (sel[i] ? v1[i] : 0));
+    REQUIRE(loaded[i] == (sel[i] ? v1[i] : 0));
+  }
+
+  for (int i = 0; i < n; ++i)
+    REQUIRE(packed[i] == active[i]);
+}
+
 // pack<> memory operations ///////////////////////////////////////////////////
 
 TEST_CASE("unmasked load()", "[memory_operations]")
@@ -687,6 +1316,55 @@ TEST_CASE("unmasked gather()", "[memory_operations]")
   REQUIRE(tsimd::all(result == 4));
 }
 
+TEST_CASE("masked gather()", "[memory_operations]")
+{
+  alignas(64) std::array<float_type, vfloat::static_size> values;
+  std::iota(values.begin(), values.end(), 1);
+
+  vint offset;
+  std::iota(offset.begin(), offset.end(), 0);
+  std::reverse(offset.begin(), offset.end());
+
+  vbool m(true);
+  m[0] = false;
+
+  auto result = tsimd::gather<vfloat>(values.data(), offset, m);
+
+  REQUIRE(result[0] == 0);
+  for (int i = 1; i < vfloat::static_size; ++i)
+    REQUIRE(result[i] == values[offset[i]]);
+}
+
+TEST_CASE("scaled gather()", "[memory_operations]")
+{
+  struct element
+  {
+    float_type value;
+    int tag;
+  };
+
+  std::array<element, vfloat::static_size> values;
+  for (int i = 0; i < vfloat::static_size; ++i)
+    values[i] = {float_type(i * 2), i};
+
+  vint offset;
+  std::iota(offset.begin(), offset.end(), 0);
+
+  auto result = tsimd::gather<vfloat, sizeof(element)>(values.data(), offset);
+
+  for (int i = 0; i < vfloat::static_size; ++i)
+    REQUIRE(result[i] == float_type(i * 2));
+
+  tsimd::pack<long long, TEST_WIDTH> offset64;
+  std::iota(offset64.begin(), offset64.end(), 0);
+
+  auto tags = tsimd::gather<tsimd::pack<int, TEST_WIDTH>, sizeof(element)>(
+      &values[0].tag, offset64);
+
+  for (int i = 0; i < vfloat::static_size; ++i)
+    REQUIRE(tags[i] == i);
+}
+
 TEST_CASE("unmasked store()", "[memory_operations]")
 {
   alignas(64) std::array<int_type, vint::static_size> values;
@@ -699,6 +1377,89 @@ TEST_CASE("unmasked store()", "[memory_operations]")
       values.begin(), values.end(), [](int_type v) { REQUIRE(v == 7); });
 }
 
+TEST_CASE("masked store()", "[memory_operations]")
+{
+  alignas(64) std::array<float_type, vfloat::static_size> values;
+  std::fill(values.begin(), values.end(), -1);
+
+  vfloat v1(3);
+
+  vbool m(false);
+  m[0] = true;
+
+  tsimd::store(v1, values.data(), m);
+
+  REQUIRE(values[0] == 3);
+  std::for_each(values.begin() + 1, values.end(), [](float_type v) {
+    REQUIRE(v == -1);
+  });
+}
+
+TEST_CASE("unaligned load()/store()", "[memory_operations]")
+{
+  alignas(64) std::array<float_type, vfloat::static_size + 1> values;
+  std::iota(values.begin(), values.end(), 0);
+
+  auto v1 = tsimd::load_unaligned<vfloat>(values.data() + 1);
+
+  for (int i = 0; i < vfloat::static_size; ++i)
+    REQUIRE(v1[i] == values[i + 1]);
+
+  tsimd::store_unaligned(v1 + 1, values.data() + 1);
+
+  for (int i = 0; i < vfloat::static_size; ++i)
+    REQUIRE(values[i + 1] == v1[i] + 1);
+}
+
+TEST_CASE("half-precision load()/store()/gather()", "[memory_operations]")
+{
+  using vfloat32 = tsimd::pack<float, TEST_WIDTH>;
+
+  std::array<tsimd::half, TEST_WIDTH + 1> values;
+
+  for (int i = 0; i <= TEST_WIDTH; ++i)
+    values[i] = tsimd::half(0.5f * i - 1.f);
+
+  REQUIRE(tsimd::half(1.f + 1.f / 2048).bits == 0x3C00);
+  REQUIRE(tsimd::half(65520.f).bits == 0x7C00);
+  REQUIRE(float(tsimd::half(-6e-8f)) == -std::ldexp(1.f, -24));
+
+  auto v1 = tsimd::load<vfloat32>(values.data() + 1);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(v1[i] == 0.5f * (i + 1) - 1.f);
+
+  tsimd::store(v1 * 4.f, values.data());
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(float(values[i]) == v1[i] * 4.f);
+
+  tsimd::pack<int, TEST_WIDTH> offsets;
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    offsets[i] = TEST_WIDTH - 1 - i;
+
+  auto v2 = tsimd::gather<vfloat32>(values.data(), offsets);
+
+  for (int i = 0; i < TEST_WIDTH; ++i)
+    REQUIRE(v2[i] == float(values[TEST_WIDTH - 1 - i]));
+}
+
+TEST_CASE("streaming store()", "[memory_operations]")
+{
+  alignas(64) std::array<int_type, vint::static_size> values;
+
+  tsimd::prefetch<tsimd::prefetch_hint::NTA>(values.data());
+
+  vint v1(9);
+
+  tsimd::store_stream(v1, values.data());
+  tsimd::stream_fence();
+
+  std::for_each(
+      values.begin(), values.end(), [](int_type v) { REQUIRE(v == 9); });
+}
+
 TEST_CASE("unmasked scatter()", "[memory_operations]")
 {
   alignas(64) std::array<int_type, vint::static_size> values;
@@ -714,6 +1475,54 @@ TEST_CASE("unmasked scatter()", "[memory_operations]")
       values.begin(), values.end(), [](int_type v) { REQUIRE(v == 5); });
 }
 
+TEST_CASE("masked/scaled scatter()", "[memory_operations]")
+{
+  alignas(64) std::array<int_type, 2 * vint::static_size> values;
+  std::fill(values.begin(), values.end(), 0);
+
+  vint v1;
+  std::iota(v1.begin(), v1.end(), 1);
+
+  vint offset;
+  std::iota(offset.begin(), offset.end(), 0);
+
+  vbool m(true);
+  m[0] = false;
+
+  tsimd::scatter<2 * sizeof(int_type)>(v1, values.data(), offset, m);
+
+  for (int i = 0; i < vint::static_size; ++i) {
+    REQUIRE(values[2 * i] == (i == 0 ? 0 : v1[i]));
+    REQUIRE(values[2 * i + 1] == 0);
+  }
+}
+
+TEST_CASE("scatter_add()", "[memory_operations]")
+{
+  std::array<float_type, 3> histogram;
+  histogram.fill(1);
+
+  vfloat v1;
+  std::iota(v1.begin(), v1.end(), 1);
+
+  vint offset;
+  for (int i = 0; i < vint::static_size; ++i)
+    offset[i] = i % 3;
+
+  vbool m(true);
+  m[0] = false;
+
+  tsimd::scatter_add(v1, histogram.data(), offset, m);
+
+  std::array<float_type, 3> expected;
+  expected.fill(1);
+  for (int i = 1; i < vfloat::static_size; ++i)
+    expected[i % 3] += v1[i];
+
+  for (int i = 0; i < 3; ++i)
+    REQUIRE(histogram[i] == expected[i]);
+}
+
 #if !TEST_DOUBLE_PRECISION
 TEST_CASE("reverse_bits()", "[memory_operations]")
 {
@@ -773,3 +1582,56 @@ TEST_CASE("precomputed_halton_engine<base>()", "[random]")
   precomputed_halton_test<10>();
 }
 
+// CPU detection and dispatch /////////////////////////////////////////////////
+
+namespace {
+
+  int dispatch_scalar(int x)
+  {
+    return x;
+  }
+
+  int dispatch_sse42(int x)
+  {
+    return x + 1;
+  }
+
+  int dispatch_avx2(int x)
+  {
+    return x + 2;
+  }
+
+}  // namespace
+
+TEST_CASE("cpu::host()/dispatcher<>", "[cpu]")
+{
+  using tsimd::cpu::isa;
+
+  // this test binary is running, so the host supports what it was built for
+  REQUIRE(tsimd::cpu::supports(tsimd::cpu::compiled_isa()));
+  REQUIRE(tsimd::cpu::target_isa() <= tsimd::cpu::best_isa(tsimd::cpu::host()));
+
+  isa parsed;
+  REQUIRE(tsimd::cpu::parse_isa("avx2", parsed));
+  REQUIRE(parsed == isa::avx2);
+  REQUIRE(!tsimd::cpu::parse_isa("avx3", parsed));
+
+  tsimd::cpu::features f;
+  f.sse42 = true;
+
+  const tsimd::cpu::dispatcher<int(int)> k1({{isa::scalar, dispatch_scalar},
+                                             {isa::avx2, dispatch_avx2},
+                                             {isa::sse42, dispatch_sse42}},
+                                            isa::avx512skx,
+                                            f);
+  REQUIRE(k1.chosen_isa() == isa::sse42);
+  REQUIRE(k1(1) == 2);
+
+  const tsimd::cpu::dispatcher<int(int)> k2({{isa::avx2, dispatch_avx2}},
+                                            isa::avx512skx,
+                                            f);
+  REQUIRE(!k2);
+
+  const tsimd::cpu::dispatcher<int(int)> k3{{isa::scalar, dispatch_scalar}};
+  REQUIRE(k3(1) == 1);
+}
@@ -85,6 +85,18 @@
 #define DO_NOT_USE \
   static_assert(false, "This function should not be used in this context!");
 
+// NOTE(jda) - TSIMD_MATH_PRECISION selects what exp(), log(), pow(), sin(),
+//             cos(), rcp() and rsqrt() do for float packs: TSIMD_MATH_ACCURATE
+//             (default) stays within a few ULP and handles IEEE special
+//             cases, TSIMD_MATH_FAST trades precision (>= 12 bits) for speed.
+//             The fast_*() variants are always available regardless.
+#define TSIMD_MATH_ACCURATE 0
+#define TSIMD_MATH_FAST     1
+
+#if !defined(TSIMD_MATH_PRECISION)
+#define TSIMD_MATH_PRECISION TSIMD_MATH_ACCURATE
+#endif
+
 #if !defined(TSIMD_DEFAULT_NEAR_EQUAL_EPSILON)
 #define TSIMD_DEFAULT_NEAR_EQUAL_EPSILON 1e-6f
 #endif
@@ -111,6 +123,22 @@
 # define TSIMD_COMPILER_MSVC  1
 #endif
 
+// NOTE(jda) - defining TSIMD_REPORT_SCALAR_FALLBACKS makes the compiler emit a
+//             message for each 64-bit element operation which still loops over
+//             lanes in scalar code for the ISA being compiled for.
+#if defined(TSIMD_REPORT_SCALAR_FALLBACKS)
+# if TSIMD_COMPILER_MSVC
+#  define TSIMD_SCALAR_FALLBACK(name) \
+     __pragma(message("tsimd scalar fallback: " name))
+# else
+#  define TSIMD_PRAGMA(x) _Pragma(#x)
+#  define TSIMD_SCALAR_FALLBACK(name) \
+     TSIMD_PRAGMA(message("tsimd scalar fallback: " name))
+# endif
+#else
+# define TSIMD_SCALAR_FALLBACK(name)
+#endif
+
 namespace tsimd {
   namespace detail {
 
@@ -0,0 +1,874 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+
+#pragma once
+
+#include <cmath>
+
+#include "pack.h"
+
+namespace tsimd {
+
+  // NOTE(jda) - convert_elements_to<>() truncates toward zero when going from
+  //             floating point to integer elements (same as a scalar cast),
+  //             where round_elements_to<>() rounds using the current MXCSR
+  //             rounding mode (round-to-nearest-even by default).
+
+  template <typename OTHER_T, typename T, int W>
+  TSIMD_INLINE pack<OTHER_T, W> round_elements_to(const pack<T, W> &from);
+
+  namespace detail {
+
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> round_elements_loop(const pack<T, W> &from)
+    {
+      pack<OTHER_T, W> to;
+
+      for (int i = 0; i < W; ++i)
+        to[i] = static_cast<OTHER_T>(std::nearbyint(from[i]));
+
+      return to;
+    }
+
+    // NOTE(jda) - Split a conversion into two conversions of the half-width
+    //             pack<> types, which lets the non-native wide types reuse the
+    //             native narrower conversions below.
+
+    template <typename OTHER_T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> combine_halves(const pack<OTHER_T, W / 2> &lo,
+                                                 const pack<OTHER_T, W / 2> &hi)
+    {
+      using half_t = typename pack<OTHER_T, W>::half_intrinsic_t;
+      return pack<OTHER_T, W>(static_cast<const half_t &>(lo),
+                              static_cast<const half_t &>(hi));
+    }
+
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> convert_halves(const pack<T, W> &from)
+    {
+      using half_pack_t = pack<T, W / 2>;
+      return combine_halves<OTHER_T, W>(
+          convert_elements_to<OTHER_T>(half_pack_t(from.vl)),
+          convert_elements_to<OTHER_T>(half_pack_t(from.vh)));
+    }
+
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> round_halves(const pack<T, W> &from)
+    {
+      using half_pack_t = pack<T, W / 2>;
+      return combine_halves<OTHER_T, W>(
+          round_elements_to<OTHER_T>(half_pack_t(from.vl)),
+          round_elements_to<OTHER_T>(half_pack_t(from.vh)));
+    }
+
+  }  // namespace detail
+
+  // round_elements_to<>() ////////////////////////////////////////////////////
+
+  template <typename OTHER_T, typename T, int W>
+  TSIMD_INLINE pack<OTHER_T, W> round_elements_to(const pack<T, W> &from)
+  {
+    static_assert(traits::is_floating_point<T>::value,
+                  "round_elements_to<>() requires floating point elements!");
+    return detail::round_elements_loop<OTHER_T>(from);
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vint4 round_elements_to<int>(const vfloat4 &from)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cvtps_epi32(from);
+#else
+    return detail::round_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 round_elements_to<int>(const vdouble4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtpd_epi32(from);
+#else
+    return detail::round_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 round_elements_to<long long>(const vdouble4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvtpd_epi64(from);
+#else
+    return detail::round_elements_loop<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 round_elements_to<long long>(const vfloat4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvtps_epi64(from);
+#else
+    return detail::round_elements_loop<long long>(from);
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vint8 round_elements_to<int>(const vfloat8 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtps_epi32(from);
+#else
+    return detail::round_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 round_elements_to<int>(const vdouble8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtpd_epi32(from);
+#else
+    return detail::round_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 round_elements_to<long long>(const vdouble8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvtpd_epi64(from);
+#else
+    return detail::round_halves<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 round_elements_to<long long>(const vfloat8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvtps_epi64(from);
+#else
+    return detail::round_halves<long long>(from);
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vint16 round_elements_to<int>(const vfloat16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtps_epi32(from);
+#else
+    return detail::round_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 round_elements_to<int>(const vdouble16 &from)
+  {
+    return detail::round_halves<int>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 round_elements_to<long long>(const vdouble16 &from)
+  {
+    return detail::round_halves<long long>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 round_elements_to<long long>(const vfloat16 &from)
+  {
+    return detail::round_halves<long long>(from);
+  }
+
+  // convert_elements_to<>() specializations //////////////////////////////////
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vint4 convert_elements_to<int>(const vfloat4 &from)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cvttps_epi32(from);
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vint4 &from)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cvtepi32_ps(from);
+#else
+    return detail::convert_elements_loop<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 convert_elements_to<double>(const vfloat4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtps_pd(from);
+#else
+    return detail::convert_elements_loop<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vdouble4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtpd_ps(from);
+#else
+    return detail::convert_elements_loop<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 convert_elements_to<double>(const vint4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtepi32_pd(from);
+#else
+    return detail::convert_elements_loop<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 convert_elements_to<int>(const vdouble4 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvttpd_epi32(from);
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 convert_elements_to<long long>(const vint4 &from)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi32_epi64(from);
+#else
+    return detail::convert_elements_loop<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 convert_elements_to<int>(const vllong4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepi64_epi32(from);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+        from, _mm256_setr_epi32(0, 2, 4, 6, 0, 0, 0, 0)));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 convert_elements_to<long long>(const vdouble4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvttpd_epi64(from);
+#else
+    return detail::convert_elements_loop<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 convert_elements_to<double>(const vllong4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvtepi64_pd(from);
+#else
+    return detail::convert_elements_loop<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 convert_elements_to<long long>(const vfloat4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvttps_epi64(from);
+#else
+    return detail::convert_elements_loop<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vllong4 &from)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512DQ__)
+    return _mm256_cvtepi64_ps(from);
+#else
+    return detail::convert_elements_loop<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 convert_elements_to<unsigned int>(const vint4 &from)
+  {
+#if defined(__SSE4_2__)
+    return vuint4(static_cast<const __m128i &>(from));
+#else
+    return detail::convert_elements_loop<unsigned int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 convert_elements_to<int>(const vuint4 &from)
+  {
+#if defined(__SSE4_2__)
+    return vint4(static_cast<const __m128i &>(from));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 convert_elements_to<float>(const vuint4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvtepu32_ps(from);
+#elif defined(__SSE4_2__)
+    // NOTE(jda) - both 16-bit halves convert exactly, so the sum is rounded
+    //             only once
+    const __m128i lo = _mm_and_si128(from, _mm_set1_epi32(0xFFFF));
+    const __m128i hi = _mm_srli_epi32(from, 16);
+    return _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(hi), _mm_set1_ps(65536.f)),
+                      _mm_cvtepi32_ps(lo));
+#else
+    return detail::convert_elements_loop<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 convert_elements_to<unsigned int>(const vfloat4 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm_cvttps_epu32(from);
+#elif defined(__SSE4_2__)
+    const __m128 two31  = _mm_set1_ps(2147483648.f);
+    const __m128 is_big = _mm_cmpge_ps(from, two31);
+    const __m128i small = _mm_cvttps_epi32(from);
+    const __m128i big   = _mm_xor_si128(
+        _mm_cvttps_epi32(_mm_sub_ps(from, two31)), _mm_set1_epi32(0x80000000));
+    return _mm_blendv_epi8(small, big, _mm_castps_si128(is_big));
+#else
+    return detail::convert_elements_loop<unsigned int>(from);
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vfloat8 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvttps_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vint8 &from)
+  {
+#if defined(__AVX__)
+    return _mm256_cvtepi32_ps(from);
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 convert_elements_to<double>(const vfloat8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtps_pd(from);
+#else
+    return detail::convert_halves<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vdouble8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtpd_ps(from);
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 convert_elements_to<double>(const vint8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_pd(from);
+#else
+    return detail::convert_halves<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vdouble8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvttpd_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 convert_elements_to<long long>(const vint8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi64(from);
+#else
+    return detail::convert_halves<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vllong8 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi64_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 convert_elements_to<long long>(const vdouble8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvttpd_epi64(from);
+#else
+    return detail::convert_halves<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 convert_elements_to<double>(const vllong8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvtepi64_pd(from);
+#else
+    return detail::convert_halves<double>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 convert_elements_to<long long>(const vfloat8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvttps_epi64(from);
+#else
+    return detail::convert_halves<long long>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vllong8 &from)
+  {
+#if defined(__AVX512DQ__)
+    return _mm512_cvtepi64_ps(from);
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 convert_elements_to<unsigned int>(const vint8 &from)
+  {
+#if defined(__AVX__)
+    return vuint8(static_cast<const __m256i &>(from));
+#else
+    return detail::convert_halves<unsigned int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vuint8 &from)
+  {
+#if defined(__AVX__)
+    return vint8(static_cast<const __m256i &>(from));
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 convert_elements_to<float>(const vuint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepu32_ps(from);
+#elif defined(__AVX2__)
+    const __m256i lo = _mm256_and_si256(from, _mm256_set1_epi32(0xFFFF));
+    const __m256i hi = _mm256_srli_epi32(from, 16);
+    return _mm256_add_ps(
+        _mm256_mul_ps(_mm256_cvtepi32_ps(hi), _mm256_set1_ps(65536.f)),
+        _mm256_cvtepi32_ps(lo));
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 convert_elements_to<unsigned int>(const vfloat8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvttps_epu32(from);
+#elif defined(__AVX__)
+    const __m256 two31  = _mm256_set1_ps(2147483648.f);
+    const __m256 is_big = _mm256_cmp_ps(from, two31, _CMP_GE_OQ);
+    const __m256 small  = _mm256_castsi256_ps(_mm256_cvttps_epi32(from));
+    const __m256 big = _mm256_xor_ps(
+        _mm256_castsi256_ps(_mm256_cvttps_epi32(_mm256_sub_ps(from, two31))),
+        _mm256_castsi256_ps(_mm256_set1_epi32(0x80000000)));
+    return _mm256_castps_si256(_mm256_blendv_ps(small, big, is_big));
+#else
+    return detail::convert_halves<unsigned int>(from);
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vfloat16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvttps_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_ps(from);
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble16 convert_elements_to<double>(const vfloat16 &from)
+  {
+    return detail::convert_halves<double>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vdouble16 &from)
+  {
+    return detail::convert_halves<float>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vdouble16 convert_elements_to<double>(const vint16 &from)
+  {
+    return detail::convert_halves<double>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vdouble16 &from)
+  {
+    return detail::convert_halves<int>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 convert_elements_to<long long>(const vint16 &from)
+  {
+    return detail::convert_halves<long long>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vllong16 &from)
+  {
+    return detail::convert_halves<int>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 convert_elements_to<long long>(const vdouble16 &from)
+  {
+    return detail::convert_halves<long long>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vdouble16 convert_elements_to<double>(const vllong16 &from)
+  {
+    return detail::convert_halves<double>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 convert_elements_to<long long>(const vfloat16 &from)
+  {
+    return detail::convert_halves<long long>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vllong16 &from)
+  {
+    return detail::convert_halves<float>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 convert_elements_to<unsigned int>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return vuint16(static_cast<const __m512i &>(from));
+#else
+    return detail::convert_halves<unsigned int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vuint16 &from)
+  {
+#if defined(__AVX512F__)
+    return vint16(static_cast<const __m512i &>(from));
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 convert_elements_to<float>(const vuint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu32_ps(from);
+#else
+    return detail::convert_halves<float>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 convert_elements_to<unsigned int>(const vfloat16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvttps_epu32(from);
+#else
+    return detail::convert_halves<unsigned int>(from);
+#endif
+  }
+
+  // 32-wide //
+
+  template <>
+  TSIMD_INLINE vint32 convert_elements_to<int>(const vfloat32 &from)
+  {
+    return detail::convert_halves<int>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vfloat32 convert_elements_to<float>(const vint32 &from)
+  {
+    return detail::convert_halves<float>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vdouble32 convert_elements_to<double>(const vfloat32 &from)
+  {
+    return detail::convert_halves<double>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vfloat32 convert_elements_to<float>(const vdouble32 &from)
+  {
+    return detail::convert_halves<float>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vdouble32 convert_elements_to<double>(const vint32 &from)
+  {
+    return detail::convert_halves<double>(from);
+  }
+
+  template <>
+  TSIMD_INLINE vint32 convert_elements_to<int>(const vdouble32 &from)
+  {
+    return detail::convert_halves<int>(from);
+  }
+
+  // 8-bit and 16-bit //
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vchar16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi8_epi32(from);
+#elif defined(__AVX2__)
+    return vint16(_mm256_cvtepi8_epi32(from),
+                  _mm256_cvtepi8_epi32(_mm_srli_si128(from, 8)));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vuchar16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu8_epi32(from);
+#elif defined(__AVX2__)
+    return vint16(_mm256_cvtepu8_epi32(from),
+                  _mm256_cvtepu8_epi32(_mm_srli_si128(from, 8)));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vshort8 &from)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepi16_epi32(from);
+#elif defined(__SSE4_2__)
+    return vint8(_mm_cvtepi16_epi32(from),
+                 _mm_cvtepi16_epi32(_mm_srli_si128(from, 8)));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 convert_elements_to<int>(const vushort8 &from)
+  {
+#if defined(__AVX2__)
+    return _mm256_cvtepu16_epi32(from);
+#elif defined(__SSE4_2__)
+    return vint8(_mm_cvtepu16_epi32(from),
+                 _mm_cvtepu16_epi32(_mm_srli_si128(from, 8)));
+#else
+    return detail::convert_elements_loop<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vshort16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi16_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 convert_elements_to<int>(const vushort16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepu16_epi32(from);
+#else
+    return detail::convert_halves<int>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vchar16 convert_elements_to<int8_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi8(from);
+#else
+    return detail::convert_elements_loop<int8_t>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 convert_elements_to<uint8_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi8(from);
+#else
+    return detail::convert_elements_loop<uint8_t>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 convert_elements_to<int16_t>(const vint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepi32_epi16(from);
+#elif defined(__SSE4_2__)
+    const __m128i low_words =
+        _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    return _mm_unpacklo_epi64(_mm_shuffle_epi8(from.vl, low_words),
+                              _mm_shuffle_epi8(from.vh, low_words));
+#else
+    return detail::convert_elements_loop<int16_t>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 convert_elements_to<uint16_t>(const vint8 &from)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cvtepi32_epi16(from);
+#elif defined(__SSE4_2__)
+    const __m128i low_words =
+        _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+    return _mm_unpacklo_epi64(_mm_shuffle_epi8(from.vl, low_words),
+                              _mm_shuffle_epi8(from.vh, low_words));
+#else
+    return detail::convert_elements_loop<uint16_t>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 convert_elements_to<int16_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi16(from);
+#else
+    return detail::convert_halves<int16_t>(from);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 convert_elements_to<uint16_t>(const vint16 &from)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtepi32_epi16(from);
+#else
+    return detail::convert_halves<uint16_t>(from);
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,299 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cctype>
+#include <cstdlib>
+
+#include "../config.h"
+
+#if TSIMD_WIN
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace tsimd {
+  namespace cpu {
+
+    // NOTE(jda) - ISA levels are ordered oldest to newest, and match the
+    //             targets in cmake/<compiler>.cmake: a kernel compiled for
+    //             one of these can only run if supports() says so (note that
+    //             avx512knl and avx512skx are not subsets of each other).
+    enum class isa
+    {
+      scalar = 0,
+      sse42,
+      avx,
+      avx2,
+      avx512knl,
+      avx512skx
+    };
+
+    struct features
+    {
+      bool sse42{false};
+      bool avx{false};
+      bool f16c{false};
+      bool fma{false};
+      bool avx2{false};
+      bool bmi1{false};
+      bool bmi2{false};
+      bool lzcnt{false};
+      bool avx512f{false};
+      bool avx512cd{false};
+      bool avx512er{false};
+      bool avx512pf{false};
+      bool avx512dq{false};
+      bool avx512bw{false};
+      bool avx512vl{false};
+    };
+
+    namespace detail {
+
+      TSIMD_INLINE bool cpuid(unsigned int leaf,
+                              unsigned int subleaf,
+                              unsigned int regs[4])
+      {
+#if TSIMD_WIN
+        int r[4];
+        __cpuid(r, leaf & 0x80000000);
+        if (unsigned(r[0]) < leaf)
+          return false;
+        __cpuidex(r, leaf, subleaf);
+        for (int i = 0; i < 4; ++i)
+          regs[i] = unsigned(r[i]);
+        return true;
+#elif defined(__x86_64__) || defined(__i386__)
+        if (__get_cpuid_max(leaf & 0x80000000, nullptr) < leaf)
+          return false;
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+        return true;
+#else
+        return false;
+#endif
+      }
+
+      // NOTE(jda) - The OS has to save the wider register state on context
+      //             switches too, which XCR0 reports (YMM: bits 1-2, ZMM and
+      //             opmask: bits 5-7).
+      TSIMD_INLINE unsigned long long xgetbv()
+      {
+#if TSIMD_WIN
+        return _xgetbv(0);
+#elif defined(__x86_64__) || defined(__i386__)
+        unsigned int eax, edx;
+        __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+        return (static_cast<unsigned long long>(edx) << 32) | eax;
+#else
+        return 0;
+#endif
+      }
+
+      TSIMD_INLINE bool bit(unsigned int reg, int b)
+      {
+        return (reg >> b) & 1;
+      }
+
+      TSIMD_INLINE features detect()
+      {
+        features f;
+        unsigned int r1[4]  = {0, 0, 0, 0};
+        unsigned int r7[4]  = {0, 0, 0, 0};
+        unsigned int rx1[4] = {0, 0, 0, 0};
+
+        if (!cpuid(1, 0, r1))
+          return f;
+
+        cpuid(7, 0, r7);
+        cpuid(0x80000001, 0, rx1);
+
+        const bool osxsave = bit(r1[2], 27);
+        const auto xcr0    = osxsave ? xgetbv() : 0ULL;
+        const bool os_ymm  = (xcr0 & 0x6) == 0x6;
+        const bool os_zmm  = (xcr0 & 0xE6) == 0xE6;
+
+        f.sse42 = bit(r1[2], 20);
+        f.bmi1  = bit(r7[1], 3);
+        f.bmi2  = bit(r7[1], 8);
+        f.lzcnt = bit(rx1[2], 5);
+
+        if (os_ymm) {
+          f.avx  = bit(r1[2], 28);
+          f.f16c = bit(r1[2], 29);
+          f.fma  = bit(r1[2], 12);
+          f.avx2 = bit(r7[1], 5);
+        }
+
+        if (os_zmm) {
+          f.avx512f  = bit(r7[1], 16);
+          f.avx512dq = bit(r7[1], 17);
+          f.avx512pf = bit(r7[1], 26);
+          f.avx512er = bit(r7[1], 27);
+          f.avx512cd = bit(r7[1], 28);
+          f.avx512bw = bit(r7[1], 30);
+          f.avx512vl = bit(r7[1], 31);
+        }
+
+        return f;
+      }
+
+    }  // namespace detail
+
+    // Queries ////////////////////////////////////////////////////////////////
+
+    // NOTE(jda) - CPUID is only issued once, the first time this is called.
+    TSIMD_INLINE const features &host()
+    {
+      static const features f = detail::detect();
+      return f;
+    }
+
+    TSIMD_INLINE bool supports(const features &f, isa i)
+    {
+      switch (i) {
+      case isa::scalar:
+        return true;
+      case isa::sse42:
+        return f.sse42;
+      case isa::avx:
+        return f.sse42 && f.avx;
+      case isa::avx2:
+        return supports(f, isa::avx) && f.avx2 && f.fma && f.f16c && f.bmi1 &&
+               f.bmi2 && f.lzcnt;
+      case isa::avx512knl:
+        return supports(f, isa::avx2) && f.avx512f && f.avx512cd &&
+               f.avx512er && f.avx512pf;
+      case isa::avx512skx:
+        return supports(f, isa::avx2) && f.avx512f && f.avx512cd &&
+               f.avx512dq && f.avx512bw && f.avx512vl;
+      }
+      return false;
+    }
+
+    TSIMD_INLINE bool supports(isa i)
+    {
+      return supports(host(), i);
+    }
+
+    TSIMD_INLINE isa best_isa(const features &f)
+    {
+      for (int i = int(isa::avx512skx); i > int(isa::scalar); --i)
+        if (supports(f, isa(i)))
+          return isa(i);
+
+      return isa::scalar;
+    }
+
+    // NOTE(jda) - The ISA the current translation unit is compiled for.
+    constexpr isa compiled_isa()
+    {
+#if defined(__AVX512BW__) && defined(__AVX512VL__)
+      return isa::avx512skx;
+#elif defined(__AVX512ER__)
+      return isa::avx512knl;
+#elif defined(__AVX2__)
+      return isa::avx2;
+#elif defined(__AVX__)
+      return isa::avx;
+#elif defined(__SSE4_2__)
+      return isa::sse42;
+#else
+      return isa::scalar;
+#endif
+    }
+
+    // Names //////////////////////////////////////////////////////////////////
+
+    TSIMD_INLINE const char *name(isa i)
+    {
+      switch (i) {
+      case isa::scalar:
+        return "SCALAR";
+      case isa::sse42:
+        return "SSE4";
+      case isa::avx:
+        return "AVX";
+      case isa::avx2:
+        return "AVX2";
+      case isa::avx512knl:
+        return "AVX512KNL";
+      case isa::avx512skx:
+        return "AVX512SKX";
+      }
+      return "UNKNOWN";
+    }
+
+    // NOTE(jda) - Accepts the same (case insensitive) names as name(), plus
+    //             "SSE42". Returns false if 'str' isn't a known ISA.
+    TSIMD_INLINE bool parse_isa(const char *str, isa &out)
+    {
+      if (str == nullptr)
+        return false;
+
+      auto equals = [](const char *a, const char *b) -> bool {
+        for (; *a && *b; ++a, ++b)
+          if (std::toupper(static_cast<unsigned char>(*a)) != *b)
+            return false;
+        return *a == *b;
+      };
+
+      if (equals(str, "SSE42")) {
+        out = isa::sse42;
+        return true;
+      }
+
+      for (int i = int(isa::scalar); i <= int(isa::avx512skx); ++i) {
+        if (equals(str, name(isa(i)))) {
+          out = isa(i);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // NOTE(jda) - The ISA that dispatch targets: the best one the host
+    //             supports, unless the TSIMD_ISA environment variable names
+    //             an older one (useful to test the fallback paths). This is
+    //             computed once and then cached.
+    TSIMD_INLINE isa target_isa()
+    {
+      static const isa target = []() -> isa {
+        const isa best = best_isa(host());
+        isa requested;
+
+        if (parse_isa(std::getenv("TSIMD_ISA"), requested) &&
+            requested < best)
+          return requested;
+
+        return best;
+      }();
+
+      return target;
+    }
+
+  }  // namespace cpu
+}  // namespace tsimd
@@ -0,0 +1,110 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <initializer_list>
+#include <utility>
+
+#include "detect.h"
+
+namespace tsimd {
+  namespace cpu {
+
+    // dispatcher<> ///////////////////////////////////////////////////////////
+
+    // NOTE(jda) - Binds a family of versions of the same kernel, each compiled
+    //             for a different ISA (i.e. in separate translation units with
+    //             different flags), to the best one for target_isa(). The
+    //             choice is made once when the dispatcher is constructed, so
+    //             a function-local or global static makes calling it only
+    //             cost an indirect call:
+    //
+    //             static const tsimd::cpu::dispatcher<void(float *, int)> k{
+    //                 {tsimd::cpu::isa::avx512skx, kernel_avx512skx},
+    //                 {tsimd::cpu::isa::avx2, kernel_avx2},
+    //                 {tsimd::cpu::isa::sse42, kernel_sse42}};
+    //             k(data, n);
+
+    template <typename FCN_T>
+    class dispatcher;
+
+    template <typename R, typename... Args>
+    class dispatcher<R(Args...)>
+    {
+    public:
+      using function_t = R (*)(Args...);
+      using entry_t    = std::pair<isa, function_t>;
+
+      dispatcher(std::initializer_list<entry_t> entries)
+          : dispatcher(entries, target_isa(), host())
+      {
+      }
+
+      // NOTE(jda) - Explicitly choose for a given ISA and set of features,
+      //             which is mostly useful for testing.
+      dispatcher(std::initializer_list<entry_t> entries,
+                 isa target,
+                 const features &f)
+      {
+        for (const auto &e : entries) {
+          if (e.first > target || !supports(f, e.first) || e.second == nullptr)
+            continue;
+
+          if (selected == nullptr || e.first > chosen) {
+            selected = e.second;
+            chosen   = e.first;
+          }
+        }
+      }
+
+      TSIMD_INLINE R operator()(Args... args) const
+      {
+        return selected(std::forward<Args>(args)...);
+      }
+
+      // NOTE(jda) - False if none of the entries can run on this CPU, in which
+      //             case calling the dispatcher is undefined.
+      TSIMD_INLINE explicit operator bool() const
+      {
+        return selected != nullptr;
+      }
+
+      TSIMD_INLINE function_t function() const
+      {
+        return selected;
+      }
+
+      TSIMD_INLINE isa chosen_isa() const
+      {
+        return chosen;
+      }
+
+    private:
+      function_t selected{nullptr};
+      isa chosen{isa::scalar};
+    };
+
+  }  // namespace cpu
+}  // namespace tsimd
@@ -26,8 +26,16 @@
 
 #include "algorithm/all.h"
 #include "algorithm/any.h"
+#include "algorithm/bitmask.h"
+#include "algorithm/conflict.h"
 #include "algorithm/foreach.h"
 #include "algorithm/lane_index.h"
 #include "algorithm/near_equal.h"
+#include "algorithm/reduce_add.h"
+#include "algorithm/reduce_and.h"
+#include "algorithm/reduce_max.h"
+#include "algorithm/reduce_min.h"
+#include "algorithm/reduce_mul.h"
+#include "algorithm/reduce_or.h"
 #include "algorithm/select.h"
 #include "algorithm/set_if.h"
@@ -42,6 +42,17 @@ namespace tsimd {
     return any(a);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE bool all(const vboold2 &a)
+  {
+#if defined(__SSE4_2__)
+    return _mm_movemask_pd(a) == 0x3;
+#else
+    return a[0] && a[1];
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE bool all(const vboolf4 &a)
@@ -60,12 +71,17 @@ namespace tsimd {
 
   TSIMD_INLINE bool all(const vboold4 &a)
   {
+#if defined(__AVX__)
+    return _mm256_movemask_pd(a) == 0xf;
+#else
+    TSIMD_SCALAR_FALLBACK("all(vboold4)");
     for (int i = 0; i < 4; ++i) {
       if (!a[i])
         return false;
     }
 
     return true;
+#endif
   }
 
   // 8-wide //
@@ -110,4 +126,74 @@ namespace tsimd {
 #endif
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, bool> all(const pack<T, W> &a)
+  {
+    using half_t = pack<T, W / 2>;
+    return all(half_t(a.vl)) && all(half_t(a.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_bool_t<T>>
+  TSIMD_INLINE bool all(const pack<T, W> &a)
+  {
+    for (int i = 0; i < W; ++i) {
+      if (!a[i])
+        return false;
+    }
+
+    return true;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE bool all(const vboolc16 &a)
+  {
+    return _mm_movemask_epi8(a) == 0xFFFF;
+  }
+
+  TSIMD_INLINE bool all(const vbools8 &a)
+  {
+    return _mm_movemask_epi8(a) == 0xFFFF;
+  }
+#endif
+
+  TSIMD_INLINE bool all(const vboolc32 &a)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_testc_si256(a, _mm256_set1_epi32(-1)) != 0;
+#else
+    return all(vboolc16(a.vl)) && all(vboolc16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vbools16 &a)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_testc_si256(a, _mm256_set1_epi32(-1)) != 0;
+#else
+    return all(vbools8(a.vl)) && all(vbools8(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vboolc64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi8_mask(a) == ~0ULL;
+#else
+    return all(vboolc32(a.vl)) && all(vboolc32(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool all(const vbools32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi8_mask(a) == ~0ULL;
+#else
+    return all(vbools16(a.vl)) && all(vbools16(a.vh));
+#endif
+  }
+
 }  // namespace tsimd
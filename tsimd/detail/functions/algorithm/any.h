@@ -36,6 +36,17 @@ namespace tsimd {
     return a[0];
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE bool any(const vboold2 &a)
+  {
+#if defined(__SSE4_2__)
+    return _mm_movemask_pd(a) != 0x0;
+#else
+    return a[0] || a[1];
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE bool any(const vboolf4 &a)
@@ -54,12 +65,17 @@ namespace tsimd {
 
   TSIMD_INLINE bool any(const vboold4 &a)
   {
+#if defined(__AVX__)
+    return !_mm256_testz_pd(a, a);
+#else
+    TSIMD_SCALAR_FALLBACK("any(vboold4)");
     for (int i = 0; i < 4; ++i) {
       if (a[i])
         return true;
     }
 
     return false;
+#endif
   }
 
   // 8-wide //
@@ -104,6 +120,76 @@ namespace tsimd {
 #endif
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, bool> any(const pack<T, W> &a)
+  {
+    using half_t = pack<T, W / 2>;
+    return any(half_t(a.vl)) || any(half_t(a.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_bool_t<T>>
+  TSIMD_INLINE bool any(const pack<T, W> &a)
+  {
+    for (int i = 0; i < W; ++i) {
+      if (a[i])
+        return true;
+    }
+
+    return false;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE bool any(const vboolc16 &a)
+  {
+    return _mm_movemask_epi8(a) != 0;
+  }
+
+  TSIMD_INLINE bool any(const vbools8 &a)
+  {
+    return _mm_movemask_epi8(a) != 0;
+  }
+#endif
+
+  TSIMD_INLINE bool any(const vboolc32 &a)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return !_mm256_testz_si256(a, a);
+#else
+    return any(vboolc16(a.vl)) || any(vboolc16(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vbools16 &a)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return !_mm256_testz_si256(a, a);
+#else
+    return any(vbools8(a.vl)) || any(vbools8(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vboolc64 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_test_epi8_mask(a, a) != 0;
+#else
+    return any(vboolc32(a.vl)) || any(vboolc32(a.vh));
+#endif
+  }
+
+  TSIMD_INLINE bool any(const vbools32 &a)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_test_epi8_mask(a, a) != 0;
+#else
+    return any(vbools16(a.vl)) || any(vbools16(a.vh));
+#endif
+  }
+
   // none() ///////////////////////////////////////////////////////////////////
 
   template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
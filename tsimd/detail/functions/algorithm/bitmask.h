@@ -0,0 +1,380 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../pack.h"
+
+#if TSIMD_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace tsimd {
+
+  namespace detail {
+
+    TSIMD_INLINE int popcount_bits(uint64_t bits)
+    {
+#if TSIMD_COMPILER_MSVC
+      int count = 0;
+      for (; bits != 0; bits &= bits - 1)
+        count++;
+      return count;
+#else
+      return __builtin_popcountll(bits);
+#endif
+    }
+
+    // NOTE(jda) - both bit scans are undefined for 'bits == 0'
+
+    TSIMD_INLINE int bit_scan_forward(uint64_t bits)
+    {
+#if TSIMD_COMPILER_MSVC
+      unsigned long index;
+      _BitScanForward64(&index, bits);
+      return int(index);
+#else
+      return __builtin_ctzll(bits);
+#endif
+    }
+
+    TSIMD_INLINE int bit_scan_reverse(uint64_t bits)
+    {
+#if TSIMD_COMPILER_MSVC
+      unsigned long index;
+      _BitScanReverse64(&index, bits);
+      return int(index);
+#else
+      return 63 - __builtin_clzll(bits);
+#endif
+    }
+
+  }  // namespace detail
+
+  // to_bitmask() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - bit 'i' of the result is set when lane 'i' of the mask is on
+
+  template <typename T, int W, typename = traits::is_bool_t<T>>
+  TSIMD_INLINE uint64_t to_bitmask(const pack<T, W> &m)
+  {
+    uint64_t bits = 0;
+
+    for (int i = 0; i < W; ++i)
+      bits |= uint64_t(bool(m[i])) << i;
+
+    return bits;
+  }
+
+  // 2-wide //
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE uint64_t to_bitmask(const vboold2 &m)
+  {
+    return _mm_movemask_pd(m);
+  }
+#endif
+
+  // 4-wide //
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE uint64_t to_bitmask(const vboolf4 &m)
+  {
+    return _mm_movemask_ps(m);
+  }
+#endif
+
+#if defined(__AVX__)
+  TSIMD_INLINE uint64_t to_bitmask(const vboold4 &m)
+  {
+    return _mm256_movemask_pd(m);
+  }
+#endif
+
+  // 8-wide //
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(m);
+#elif defined(__AVX2__) || defined(__AVX__)
+    return _mm256_movemask_ps(m);
+#else
+    return to_bitmask(vboolf4(m.vl)) | (to_bitmask(vboolf4(m.vh)) << 4);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return __mmask8(m);
+#else
+    return to_bitmask(vboold4(m.vl)) | (to_bitmask(vboold4(m.vh)) << 4);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return __mmask16(m);
+#else
+    return to_bitmask(vboolf8(m.vl)) | (to_bitmask(vboolf8(m.vh)) << 8);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboold16 &m)
+  {
+#if defined(__AVX512F__)
+    return __mmask16(m.v);
+#else
+    return to_bitmask(vboold8(m.vl)) | (to_bitmask(vboold8(m.vh)) << 8);
+#endif
+  }
+
+  // 32-wide //
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboolf32 &m)
+  {
+#if defined(__AVX512F__)
+    return __mmask32(m);
+#else
+    return to_bitmask(vboolf16(m.vl)) | (to_bitmask(vboolf16(m.vh)) << 16);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboold32 &m)
+  {
+#if defined(__AVX512F__)
+    return __mmask32(m);
+#else
+    return to_bitmask(vboold16(m.vl)) | (to_bitmask(vboold16(m.vh)) << 16);
+#endif
+  }
+
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE uint64_t to_bitmask(const vboolc16 &m)
+  {
+    return uint32_t(_mm_movemask_epi8(m));
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vbools8 &m)
+  {
+    return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(m, _mm_setzero_si128())));
+  }
+#endif
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboolc32 &m)
+  {
+#if defined(__AVX2__)
+    return uint32_t(_mm256_movemask_epi8(m));
+#else
+    return to_bitmask(vboolc16(m.vl)) | (to_bitmask(vboolc16(m.vh)) << 16);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vbools16 &m)
+  {
+#if defined(__AVX2__)
+    const __m256i v = m;
+    return uint32_t(_mm_movemask_epi8(_mm_packs_epi16(
+        _mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1))));
+#else
+    return to_bitmask(vbools8(m.vl)) | (to_bitmask(vbools8(m.vh)) << 8);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vboolc64 &m)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi8_mask(m);
+#else
+    return to_bitmask(vboolc32(m.vl)) | (to_bitmask(vboolc32(m.vh)) << 32);
+#endif
+  }
+
+  TSIMD_INLINE uint64_t to_bitmask(const vbools32 &m)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movepi16_mask(m);
+#else
+    return to_bitmask(vbools16(m.vl)) | (to_bitmask(vbools16(m.vh)) << 16);
+#endif
+  }
+
+  // from_bitmask() ///////////////////////////////////////////////////////////
+
+  template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
+  TSIMD_INLINE MASK_T from_bitmask(uint64_t bits)
+  {
+    MASK_T m;
+
+    for (int i = 0; i < MASK_T::static_size; ++i)
+      m[i] = bool((bits >> i) & 1);
+
+    return m;
+  }
+
+  // 4-wide //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE vboolf4 from_bitmask<vboolf4>(uint64_t bits)
+  {
+    const __m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+    const __m128i on    = _mm_and_si128(_mm_set1_epi32(int(bits)), lanes);
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(on, lanes));
+  }
+#endif
+
+#if defined(__AVX2__)
+  template <>
+  TSIMD_INLINE vboold4 from_bitmask<vboold4>(uint64_t bits)
+  {
+    const __m256i lanes = _mm256_setr_epi64x(1, 2, 4, 8);
+    const __m256i on = _mm256_and_si256(_mm256_set1_epi64x(bits), lanes);
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(on, lanes));
+  }
+#endif
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vboolf8 from_bitmask<vboolf8>(uint64_t bits)
+  {
+#if defined(__AVX512VL__)
+    return __mmask8(bits);
+#elif defined(__AVX2__)
+    const __m256i lanes = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    const __m256i on = _mm256_and_si256(_mm256_set1_epi32(int(bits)), lanes);
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(on, lanes));
+#else
+    return vboolf8(from_bitmask<vboolf4>(bits),
+                   from_bitmask<vboolf4>(bits >> 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vboold8 from_bitmask<vboold8>(uint64_t bits)
+  {
+#if defined(__AVX512F__)
+    return __mmask8(bits);
+#else
+    return vboold8(from_bitmask<vboold4>(bits),
+                   from_bitmask<vboold4>(bits >> 4));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vboolf16 from_bitmask<vboolf16>(uint64_t bits)
+  {
+#if defined(__AVX512F__)
+    return __mmask16(bits);
+#else
+    return vboolf16(from_bitmask<vboolf8>(bits),
+                    from_bitmask<vboolf8>(bits >> 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vboold16 from_bitmask<vboold16>(uint64_t bits)
+  {
+    return vboold16(from_bitmask<vboold8>(bits),
+                    from_bitmask<vboold8>(bits >> 8));
+  }
+
+  // 32-wide //
+
+  template <>
+  TSIMD_INLINE vboolf32 from_bitmask<vboolf32>(uint64_t bits)
+  {
+#if defined(__AVX512F__)
+    return __mmask32(bits);
+#else
+    return vboolf32(from_bitmask<vboolf16>(bits),
+                    from_bitmask<vboolf16>(bits >> 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vboold32 from_bitmask<vboold32>(uint64_t bits)
+  {
+#if defined(__AVX512F__)
+    return __mmask32(bits);
+#else
+    return vboold32(from_bitmask<vboold16>(bits),
+                    from_bitmask<vboold16>(bits >> 16));
+#endif
+  }
+
+  // 8-bit and 16-bit //
+
+#if defined(__AVX512BW__)
+  template <>
+  TSIMD_INLINE vboolc64 from_bitmask<vboolc64>(uint64_t bits)
+  {
+    return _mm512_movm_epi8(bits);
+  }
+
+  template <>
+  TSIMD_INLINE vbools32 from_bitmask<vbools32>(uint64_t bits)
+  {
+    return _mm512_movm_epi16(__mmask32(bits));
+  }
+#endif
+
+  // popcount() ///////////////////////////////////////////////////////////////
+
+  template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
+  TSIMD_INLINE int popcount(const MASK_T &m)
+  {
+    return detail::popcount_bits(to_bitmask(m));
+  }
+
+  // first_active()/last_active() /////////////////////////////////////////////
+
+  // NOTE(jda) - both return -1 if no lanes are active
+
+  template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
+  TSIMD_INLINE int first_active(const MASK_T &m)
+  {
+    const uint64_t bits = to_bitmask(m);
+    return bits == 0 ? -1 : detail::bit_scan_forward(bits);
+  }
+
+  template <typename MASK_T, typename = traits::is_mask_t<MASK_T>>
+  TSIMD_INLINE int last_active(const MASK_T &m)
+  {
+    const uint64_t bits = to_bitmask(m);
+    return bits == 0 ? -1 : detail::bit_scan_reverse(bits);
+  }
+
+}  // namespace tsimd
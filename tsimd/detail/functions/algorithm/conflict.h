@@ -0,0 +1,157 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <type_traits>
+
+#include "../../pack.h"
+#include "../../convert_elements_to.h"
+#include "../../traits/is_wide_integer.h"
+
+namespace tsimd {
+
+  // conflict() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - bit 'j' of lane 'i' in the result is set when j < i and
+  //             p[j] == p[i] (i.e. vpconflictd/q), so lanes holding the first
+  //             occurrence of a value come back as 0.
+
+  template <typename T, int W, typename = traits::is_wide_integer_t<T>>
+  TSIMD_INLINE pack<T, W> conflict(const pack<T, W> &p)
+  {
+    static_assert(W <= int(sizeof(T) * 8),
+                  "tsimd::conflict() needs one bit per lane in each element");
+
+    using U = typename std::make_unsigned<T>::type;
+
+    pack<T, W> result(T(0));
+
+    for (int i = 1; i < W; ++i) {
+      U bits = 0;
+      for (int j = 0; j < i; ++j)
+        bits |= U(p[j] == p[i]) << j;
+      result[i] = T(bits);
+    }
+
+    return result;
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 conflict(const vint4 &p)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+    return _mm_conflict_epi32(p);
+#elif defined(__SSE4_2__)
+    // NOTE(jda) - compare each lane against the 1, 2, and 3 lanes below it
+    const __m128i v  = p;
+    const __m128i c1 = _mm_cmpeq_epi32(v, _mm_shuffle_epi32(v, 0x90));
+    const __m128i c2 = _mm_cmpeq_epi32(v, _mm_shuffle_epi32(v, 0x40));
+    const __m128i c3 = _mm_cmpeq_epi32(v, _mm_shuffle_epi32(v, 0x00));
+    return _mm_or_si128(
+        _mm_and_si128(c1, _mm_setr_epi32(0, 1, 2, 4)),
+        _mm_or_si128(_mm_and_si128(c2, _mm_setr_epi32(0, 0, 1, 2)),
+                     _mm_and_si128(c3, _mm_setr_epi32(0, 0, 0, 1))));
+#else
+    return conflict<int, 4, void>(p);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 conflict(const vllong4 &p)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+    return _mm256_conflict_epi64(p);
+#elif defined(__AVX2__)
+    const __m256i v  = p;
+    const __m256i c1 = _mm256_cmpeq_epi64(v, _mm256_permute4x64_epi64(v, 0x90));
+    const __m256i c2 = _mm256_cmpeq_epi64(v, _mm256_permute4x64_epi64(v, 0x40));
+    const __m256i c3 = _mm256_cmpeq_epi64(v, _mm256_permute4x64_epi64(v, 0x00));
+    return _mm256_or_si256(
+        _mm256_and_si256(c1, _mm256_setr_epi64x(0, 1, 2, 4)),
+        _mm256_or_si256(_mm256_and_si256(c2, _mm256_setr_epi64x(0, 0, 1, 2)),
+                        _mm256_and_si256(c3, _mm256_setr_epi64x(0, 0, 0, 1))));
+#else
+    return conflict<long long, 4, void>(p);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 conflict(const vint8 &p)
+  {
+#if defined(__AVX512VL__) && defined(__AVX512CD__)
+    return _mm256_conflict_epi32(p);
+#elif defined(__AVX2__)
+    // NOTE(jda) - lanes below 'k' get a negative index, which makes the
+    //             variable shift (and so their contribution) zero
+    const __m256i v    = p;
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i one  = _mm256_set1_epi32(1);
+    __m256i result     = _mm256_setzero_si256();
+
+    for (int k = 1; k < 8; ++k) {
+      const __m256i idx = _mm256_sub_epi32(lane, _mm256_set1_epi32(k));
+      const __m256i eq =
+          _mm256_cmpeq_epi32(v, _mm256_permutevar8x32_epi32(v, idx));
+      result = _mm256_or_si256(
+          result, _mm256_and_si256(eq, _mm256_sllv_epi32(one, idx)));
+    }
+
+    return result;
+#else
+    return conflict<int, 8, void>(p);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 conflict(const vllong8 &p)
+  {
+#if defined(__AVX512CD__)
+    return _mm512_conflict_epi64(p);
+#else
+    return conflict<long long, 8, void>(p);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 conflict(const vint16 &p)
+  {
+#if defined(__AVX512CD__)
+    return _mm512_conflict_epi32(p);
+#else
+    return conflict<int, 16, void>(p);
+#endif
+  }
+
+  // NOTE(jda) - unsigned elements reuse the 32-bit integer versions above
+
+  template <int W>
+  TSIMD_INLINE pack<unsigned int, W> conflict(const pack<unsigned int, W> &p)
+  {
+    return convert_elements_to<unsigned int>(
+        conflict(convert_elements_to<int>(p)));
+  }
+
+}  // namespace tsimd
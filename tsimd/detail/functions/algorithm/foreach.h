@@ -26,6 +26,8 @@
 
 #include "../../pack.h"
 
+#include "bitmask.h"
+#include "conflict.h"
 #include "select.h"
 
 namespace tsimd {
@@ -43,9 +45,9 @@ namespace tsimd {
             typename = traits::is_bool_t<BOOL_T>>
   TSIMD_INLINE void foreach_active(const pack<BOOL_T, W> &m, FCN_T &&fcn)
   {
-    for (int i = 0; i < W; ++i)
-      if (m[i])
-        fcn(i);
+    // NOTE(jda) - visit only the set bits, lowest lane first
+    for (uint64_t bits = to_bitmask(m); bits != 0; bits &= bits - 1)
+      fcn(detail::bit_scan_forward(bits));
   }
 
   template <typename T, int W, typename FCN_T>
@@ -53,24 +55,42 @@ namespace tsimd {
                                    pack<T, W> &p,
                                    FCN_T &&fcn)
   {
-    for (int i = 0; i < W; ++i)
-      if (m[i])
-        fcn(p[i]);
+    for (uint64_t bits = to_bitmask(m); bits != 0; bits &= bits - 1)
+      fcn(p[detail::bit_scan_forward(bits)]);
   }
 
+  // NOTE(jda) - fcn() is called once per distinct value among the active
+  //             lanes (in order of first appearance) with the mask of the
+  //             active lanes holding it.
+
   template <typename T, int W, typename FCN_T>
-  inline void foreach_unique(mask<T, W> mask,
-                             const pack<T, W> &p,
-                             FCN_T &&fcn)
+  inline traits::enable_if_t<!traits::is_wide_integer<T>::value>
+  foreach_unique(const mask<T, W> &m, const pack<T, W> &p, FCN_T &&fcn)
   {
-    for (int i = 0; i < W; i++) {
-      if (!mask[i]) continue;
-      const auto sValue = p[i];
-      const auto matching = (mask & (p == sValue));
-      fcn(matching, sValue);
-      // TODO: not implemented: mask ^= matchingMask;
-      // TODO: gives an error: mask = mask & ~matchingMask;
-      mask = mask ^ matching;
+    uint64_t remaining = to_bitmask(m);
+
+    while (remaining != 0) {
+      const auto value    = p[detail::bit_scan_forward(remaining)];
+      const auto matching = m & (p == value);
+      fcn(matching, value);
+      remaining &= ~to_bitmask(matching);
+    }
+  }
+
+  // NOTE(jda) - 32-bit and 64-bit integers find the first lane of each
+  //             distinct value up front with conflict(), instead of
+  //             discovering them one compare at a time
+
+  template <typename T, int W, typename FCN_T>
+  inline traits::enable_if_t<traits::is_wide_integer<T>::value>
+  foreach_unique(const mask<T, W> &m, const pack<T, W> &p, FCN_T &&fcn)
+  {
+    const auto active = pack<T, W>(T(to_bitmask(m)));
+    const auto firsts = m & ((conflict(p) & active) == pack<T, W>(T(0)));
+
+    for (uint64_t bits = to_bitmask(firsts); bits != 0; bits &= bits - 1) {
+      const T value = p[detail::bit_scan_forward(bits)];
+      fcn(m & (p == value), value);
     }
   }
 
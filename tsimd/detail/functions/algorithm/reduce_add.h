@@ -0,0 +1,385 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "../../operators/arithmetic/plus.h"
+#include "select.h"
+
+namespace tsimd {
+
+  // reduce_add() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Sum of all elements, computed with a log2(W) tree: wide packs
+  //             are folded in half until they fit a single register, which is
+  //             then reduced with in-register shuffles.
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE T reduce_add(const pack<T, 1> &p)
+  {
+    return p[0];
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE float reduce_add(const vfloat4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128 t = _mm_add_ps(p, _mm_movehl_ps(p, p));
+    return _mm_cvtss_f32(_mm_add_ss(t, _mm_shuffle_ps(t, t, 0x55)));
+#else
+    float result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result + p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE int reduce_add(const vint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_add_epi32(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_add_epi32(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result + p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_add(const vuint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_add_epi32(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_add_epi32(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    unsigned int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result + p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE double reduce_add(const vdouble4 &p)
+  {
+#if defined(__AVX__)
+    const __m128d t = _mm_add_pd(_mm256_castpd256_pd128(p),
+                                 _mm256_extractf128_pd(p, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(t, _mm_unpackhi_pd(t, t)));
+#else
+    double result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result + p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_add(const vllong4 &p)
+  {
+#if defined(__AVX2__)
+    const __m128i t = _mm_add_epi64(_mm256_castsi256_si128(p),
+                                    _mm256_extracti128_si256(p, 1));
+    return _mm_cvtsi128_si64(_mm_add_epi64(t, _mm_unpackhi_epi64(t, t)));
+#else
+    long long result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result + p[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE float reduce_add(const vfloat8 &p)
+  {
+    return reduce_add(vfloat4(p.vl) + vfloat4(p.vh));
+  }
+
+  TSIMD_INLINE int reduce_add(const vint8 &p)
+  {
+    return reduce_add(vint4(p.vl) + vint4(p.vh));
+  }
+
+  TSIMD_INLINE unsigned int reduce_add(const vuint8 &p)
+  {
+    return reduce_add(vuint4(p.vl) + vuint4(p.vh));
+  }
+
+  TSIMD_INLINE double reduce_add(const vdouble8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_add_pd(p);
+#else
+    return reduce_add(vdouble4(p.vl) + vdouble4(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_add(const vllong8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_add_epi64(p);
+#else
+    return reduce_add(vllong4(p.vl) + vllong4(p.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE float reduce_add(const vfloat16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_add_ps(p);
+#else
+    return reduce_add(vfloat8(p.vl) + vfloat8(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE int reduce_add(const vint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_add_epi32(p);
+#else
+    return reduce_add(vint8(p.vl) + vint8(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_add(const vuint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_add_epi32(p);
+#else
+    return reduce_add(vuint8(p.vl) + vuint8(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE double reduce_add(const vdouble16 &p)
+  {
+    return reduce_add(vdouble8(p.vl) + vdouble8(p.vh));
+  }
+
+  TSIMD_INLINE long long reduce_add(const vllong16 &p)
+  {
+    return reduce_add(vllong8(p.vl) + vllong8(p.vh));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, T> reduce_add(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return reduce_add(half_t(p.vl) + half_t(p.vh));
+  }
+
+  // Masked reduce_add() //
+
+  // NOTE(jda) - Inactive lanes are replaced with the identity element of the
+  //             reduction before reducing; AVX-512 does this with write masks.
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_add(const pack<T, W> &p, const mask<T, W> &m)
+  {
+    return reduce_add(select(m, p, pack<T, W>(T(0))));
+  }
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE float reduce_add(const vfloat16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_add_ps(m, p);
+  }
+
+  TSIMD_INLINE int reduce_add(const vint16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_add_epi32(m, p);
+  }
+
+  TSIMD_INLINE unsigned int reduce_add(const vuint16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_add_epi32(m, p);
+  }
+
+  TSIMD_INLINE double reduce_add(const vdouble8 &p, const vboold8 &m)
+  {
+    return _mm512_mask_reduce_add_pd(m, p);
+  }
+
+  TSIMD_INLINE long long reduce_add(const vllong8 &p, const vboold8 &m)
+  {
+    return _mm512_mask_reduce_add_epi64(m, p);
+  }
+#endif
+
+  // Multi-pack reduce_add() //
+
+  // NOTE(jda) - Reduces 4 (or 8) accumulator packs at once, returning a pack
+  //             where element 'i' is the sum of argument 'i'. The adds are
+  //             interleaved with the transpose, so this costs about the same
+  //             as a single reduction instead of one reduction per argument.
+
+  namespace detail {
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W / 2> fold_add(const pack<T, W> &p)
+    {
+      using half_pack_t = pack<T, W / 2>;
+      return half_pack_t(p.vl) + half_pack_t(p.vh);
+    }
+
+  }  // namespace detail
+
+  template <typename T>
+  TSIMD_INLINE pack<T, 4> reduce_add(const pack<T, 1> &a,
+                                     const pack<T, 1> &b,
+                                     const pack<T, 1> &c,
+                                     const pack<T, 1> &d)
+  {
+    return pack<T, 4>(a[0], b[0], c[0], d[0]);
+  }
+
+  TSIMD_INLINE vfloat4 reduce_add(const vfloat4 &a,
+                                  const vfloat4 &b,
+                                  const vfloat4 &c,
+                                  const vfloat4 &d)
+  {
+#if defined(__SSE4_2__)
+    return _mm_hadd_ps(_mm_hadd_ps(a, b), _mm_hadd_ps(c, d));
+#else
+    return vfloat4(reduce_add(a), reduce_add(b), reduce_add(c), reduce_add(d));
+#endif
+  }
+
+  TSIMD_INLINE vint4 reduce_add(const vint4 &a,
+                                const vint4 &b,
+                                const vint4 &c,
+                                const vint4 &d)
+  {
+#if defined(__SSE4_2__)
+    return _mm_hadd_epi32(_mm_hadd_epi32(a, b), _mm_hadd_epi32(c, d));
+#else
+    return vint4(reduce_add(a), reduce_add(b), reduce_add(c), reduce_add(d));
+#endif
+  }
+
+  TSIMD_INLINE vuint4 reduce_add(const vuint4 &a,
+                                 const vuint4 &b,
+                                 const vuint4 &c,
+                                 const vuint4 &d)
+  {
+#if defined(__SSE4_2__)
+    return _mm_hadd_epi32(_mm_hadd_epi32(a, b), _mm_hadd_epi32(c, d));
+#else
+    return vuint4(reduce_add(a), reduce_add(b), reduce_add(c), reduce_add(d));
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 reduce_add(const vdouble4 &a,
+                                   const vdouble4 &b,
+                                   const vdouble4 &c,
+                                   const vdouble4 &d)
+  {
+#if defined(__AVX__)
+    const __m256d ab = _mm256_hadd_pd(a, b);
+    const __m256d cd = _mm256_hadd_pd(c, d);
+    return _mm256_add_pd(_mm256_permute2f128_pd(ab, cd, 0x21),
+                         _mm256_blend_pd(ab, cd, 0xC));
+#else
+    return vdouble4(
+        reduce_add(a), reduce_add(b), reduce_add(c), reduce_add(d));
+#endif
+  }
+
+  TSIMD_INLINE vllong4 reduce_add(const vllong4 &a,
+                                  const vllong4 &b,
+                                  const vllong4 &c,
+                                  const vllong4 &d)
+  {
+    return vllong4(reduce_add(a), reduce_add(b), reduce_add(c), reduce_add(d));
+  }
+
+  template <typename T,
+            int W,
+            typename = traits::enable_if_t<(W == 2 || W > 4)>>
+  TSIMD_INLINE pack<T, 4> reduce_add(const pack<T, W> &a,
+                                     const pack<T, W> &b,
+                                     const pack<T, W> &c,
+                                     const pack<T, W> &d)
+  {
+    return reduce_add(detail::fold_add(a),
+                      detail::fold_add(b),
+                      detail::fold_add(c),
+                      detail::fold_add(d));
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, 8> reduce_add(const pack<T, W> &a,
+                                     const pack<T, W> &b,
+                                     const pack<T, W> &c,
+                                     const pack<T, W> &d,
+                                     const pack<T, W> &e,
+                                     const pack<T, W> &f,
+                                     const pack<T, W> &g,
+                                     const pack<T, W> &h)
+  {
+    return detail::combine_halves<T, 8>(reduce_add(a, b, c, d),
+                                        reduce_add(e, f, g, h));
+  }
+
+  TSIMD_INLINE vfloat8 reduce_add(const vfloat8 &a,
+                                  const vfloat8 &b,
+                                  const vfloat8 &c,
+                                  const vfloat8 &d,
+                                  const vfloat8 &e,
+                                  const vfloat8 &f,
+                                  const vfloat8 &g,
+                                  const vfloat8 &h)
+  {
+#if defined(__AVX__)
+    const __m256 abcd =
+        _mm256_hadd_ps(_mm256_hadd_ps(a, b), _mm256_hadd_ps(c, d));
+    const __m256 efgh =
+        _mm256_hadd_ps(_mm256_hadd_ps(e, f), _mm256_hadd_ps(g, h));
+    return _mm256_add_ps(_mm256_permute2f128_ps(abcd, efgh, 0x20),
+                         _mm256_permute2f128_ps(abcd, efgh, 0x31));
+#else
+    return detail::combine_halves<float, 8>(reduce_add(a, b, c, d),
+                                            reduce_add(e, f, g, h));
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,174 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "../../operators/bitwise/and.h"
+#include "select.h"
+
+namespace tsimd {
+
+  // reduce_and() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Bitwise AND of all elements, computed with a log2(W) tree:
+  //             wide packs are folded in half until they fit a single
+  //             register, which is then reduced with in-register shuffles.
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE T reduce_and(const pack<T, 1> &p)
+  {
+    return p[0];
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE int reduce_and(const vint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_and_si128(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_and_si128(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result & p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_and(const vuint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_and_si128(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_and_si128(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    unsigned int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result & p[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_and(const vllong4 &p)
+  {
+#if defined(__AVX2__)
+    const __m128i t = _mm_and_si128(_mm256_castsi256_si128(p),
+                                    _mm256_extracti128_si256(p, 1));
+    return _mm_cvtsi128_si64(_mm_and_si128(t, _mm_unpackhi_epi64(t, t)));
+#else
+    long long result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = result & p[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE int reduce_and(const vint8 &p)
+  {
+    return reduce_and(vint4(p.vl) & vint4(p.vh));
+  }
+
+  TSIMD_INLINE unsigned int reduce_and(const vuint8 &p)
+  {
+    return reduce_and(vuint4(p.vl) & vuint4(p.vh));
+  }
+
+  TSIMD_INLINE long long reduce_and(const vllong8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_and_epi64(p);
+#else
+    return reduce_and(vllong4(p.vl) & vllong4(p.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE int reduce_and(const vint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_and_epi32(p);
+#else
+    return reduce_and(vint8(p.vl) & vint8(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_and(const vuint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_and_epi32(p);
+#else
+    return reduce_and(vuint8(p.vl) & vuint8(p.vh));
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_and(const vllong16 &p)
+  {
+    return reduce_and(vllong8(p.vl) & vllong8(p.vh));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, T> reduce_and(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return reduce_and(half_t(p.vl) & half_t(p.vh));
+  }
+
+  // Masked reduce_and() //
+
+  // NOTE(jda) - Inactive lanes are replaced with the identity element of the
+  //             reduction before reducing; AVX-512 does this with write masks.
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_and(const pack<T, W> &p, const mask<T, W> &m)
+  {
+    return reduce_and(select(m, p, pack<T, W>(T(~0))));
+  }
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE int reduce_and(const vint16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_and_epi32(m, p);
+  }
+
+  TSIMD_INLINE long long reduce_and(const vllong8 &p, const vboold8 &m)
+  {
+    return _mm512_mask_reduce_and_epi64(m, p);
+  }
+#endif
+
+}  // namespace tsimd
@@ -0,0 +1,254 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "../../pack.h"
+#include "../math/max.h"
+#include "select.h"
+
+namespace tsimd {
+
+  // reduce_max() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Largest element, computed with a log2(W) tree: wide packs are
+  //             folded in half until they fit a single register, which is then
+  //             reduced with in-register shuffles.
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE T reduce_max(const pack<T, 1> &p)
+  {
+    return p[0];
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE float reduce_max(const vfloat4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128 t = _mm_max_ps(p, _mm_movehl_ps(p, p));
+    return _mm_cvtss_f32(_mm_max_ss(t, _mm_shuffle_ps(t, t, 0x55)));
+#else
+    float result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = std::max(result, p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE int reduce_max(const vint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_max_epi32(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_max_epi32(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = std::max(result, p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_max(const vuint4 &p)
+  {
+#if defined(__SSE4_2__)
+    const __m128i t = _mm_max_epu32(p, _mm_shuffle_epi32(p, 0x4E));
+    return _mm_cvtsi128_si32(_mm_max_epu32(t, _mm_shuffle_epi32(t, 0xB1)));
+#else
+    unsigned int result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = std::max(result, p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE double reduce_max(const vdouble4 &p)
+  {
+#if defined(__AVX__)
+    const __m128d t = _mm_max_pd(_mm256_castpd256_pd128(p),
+                                 _mm256_extractf128_pd(p, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(t, _mm_unpackhi_pd(t, t)));
+#else
+    double result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = std::max(result, p[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_max(const vllong4 &p)
+  {
+#if defined(__AVX512VL__)
+    const __m128i t = _mm_max_epi64(_mm256_castsi256_si128(p),
+                                    _mm256_extracti128_si256(p, 1));
+    return _mm_cvtsi128_si64(_mm_max_epi64(t, _mm_unpackhi_epi64(t, t)));
+#else
+    long long result = p[0];
+
+    for (int i = 1; i < 4; ++i)
+      result = std::max(result, p[i]);
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE float reduce_max(const vfloat8 &p)
+  {
+    return reduce_max(max(vfloat4(p.vl), vfloat4(p.vh)));
+  }
+
+  TSIMD_INLINE int reduce_max(const vint8 &p)
+  {
+    return reduce_max(max(vint4(p.vl), vint4(p.vh)));
+  }
+
+  TSIMD_INLINE unsigned int reduce_max(const vuint8 &p)
+  {
+    return reduce_max(max(vuint4(p.vl), vuint4(p.vh)));
+  }
+
+  TSIMD_INLINE double reduce_max(const vdouble8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_max_pd(p);
+#else
+    return reduce_max(max(vdouble4(p.vl), vdouble4(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE long long reduce_max(const vllong8 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_max_epi64(p);
+#else
+    return reduce_max(max(vllong4(p.vl), vllong4(p.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE float reduce_max(const vfloat16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_max_ps(p);
+#else
+    return reduce_max(max(vfloat8(p.vl), vfloat8(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE int reduce_max(const vint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_max_epi32(p);
+#else
+    return reduce_max(max(vint8(p.vl), vint8(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE unsigned int reduce_max(const vuint16 &p)
+  {
+#if defined(__AVX512F__)
+    return _mm512_reduce_max_epu32(p);
+#else
+    return reduce_max(max(vuint8(p.vl), vuint8(p.vh)));
+#endif
+  }
+
+  TSIMD_INLINE double reduce_max(const vdouble16 &p)
+  {
+    return reduce_max(max(vdouble8(p.vl), vdouble8(p.vh)));
+  }
+
+  TSIMD_INLINE long long reduce_max(const vllong16 &p)
+  {
+    return reduce_max(max(vllong8(p.vl), vllong8(p.vh)));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, T> reduce_max(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return reduce_max(max(half_t(p.vl), half_t(p.vh)));
+  }
+
+  // Masked reduce_max() //
+
+  // NOTE(jda) - Inactive lanes are replaced with the identity element of the
+  //             reduction before reducing; AVX-512 does this with write masks.
+
+  template <typename T, int W>
+  TSIMD_INLINE T reduce_max(const pack<T, W> &p, const mask<T, W> &m)
+  {
+    using limits = std::numeric_limits<T>;
+    const T identity =
+        limits::has_infinity ? -limits::infinity() : limits::lowest();
+    return reduce_max(select(m, p, pack<T, W>(identity)));
+  }
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE float reduce_max(const vfloat16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_max_ps(m, p);
+  }
+
+  TSIMD_INLINE int reduce_max(const vint16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_max_epi32(m, p);
+  }
+
+  TSIMD_INLINE unsigned int reduce_max(const vuint16 &p, const vboolf16 &m)
+  {
+    return _mm512_mask_reduce_max_epu32(m, p);
+  }
+
+  TSIMD_INLINE double reduce_max(const vdouble8 &p, const vboold8 &m)
+  {
+    return _mm512_mask_reduce_max_pd(m, p);
+  }
+
+  TSIMD_INLINE long long reduce_max(const vllong8 &p, const vboold8 &m)
+  {
+    return _mm512_mask_reduce_max_epi64(m, p);
+  }
+#endif
+
+}  // namespace tsimd
@@ -38,6 +38,41 @@ namespace tsimd {
     return pack<T, 1>(m[0] ? t[0] : f[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 select(const vboold2 &m,
+                               const vdouble2 &t,
+                               const vdouble2 &f)
+  {
+#if defined(__SSE4_2__)
+    return _mm_blendv_pd(f, t, m);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 select(const vboold2 &m,
+                              const vllong2 &t,
+                              const vllong2 &f)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castpd_si128(
+        _mm_blendv_pd(_mm_castsi128_pd(f), _mm_castsi128_pd(t), m));
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 select(const vboolf4 &m,
@@ -75,28 +110,56 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 select(const vboolf4 &m, const vuint4 &t, const vuint4 &f)
+  {
+#if defined(__SSE4_1__)
+    return _mm_castps_si128(
+        _mm_blendv_ps(_mm_castsi128_ps(f), _mm_castsi128_ps(t), m));
+#elif defined(__SSE4_2__)
+    return _mm_or_si128(_mm_and_si128(m, t), _mm_andnot_si128(m, f));
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vdouble4 select(const vboold4 &m,
                                const vdouble4 &t,
                                const vdouble4 &f)
   {
+#if defined(__AVX__)
+    return _mm256_blendv_pd(f, t, m);
+#else
+    TSIMD_SCALAR_FALLBACK("select(vboold4, vdouble4)");
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = m[i] ? t[i] : f[i];
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 select(const vboold4 &m,
                               const vllong4 &t,
                               const vllong4 &f)
   {
+#if defined(__AVX2__)
+    return _mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(f), _mm256_castsi256_pd(t), m));
+#else
+    TSIMD_SCALAR_FALLBACK("select(vboold4, vllong4)");
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = m[i] ? t[i] : f[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -128,6 +191,19 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 select(const vboolf8 &m, const vuint8 &t, const vuint8 &f)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_blend_epi32(m, f, t);
+#elif defined(__AVX2__) || defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_blendv_ps(_mm256_castsi256_ps(f), _mm256_castsi256_ps(t), m));
+#else
+    return vuint8(select(vboolf4(m.vl), vuint4(t.vl), vuint4(f.vl)),
+                  select(vboolf4(m.vh), vuint4(t.vh), vuint4(f.vh)));
+#endif
+  }
+
   TSIMD_INLINE vdouble8 select(const vboold8 &m,
                                const vdouble8 &t,
                                const vdouble8 &f)
@@ -178,6 +254,18 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 select(const vboolf16 &m,
+                              const vuint16 &t,
+                              const vuint16 &f)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_blend_epi32(m, f, t);
+#else
+    return vuint16(select(vboolf8(m.vl), vuint8(t.vl), vuint8(f.vl)),
+                   select(vboolf8(m.vh), vuint8(t.vh), vuint8(f.vh)));
+#endif
+  }
+
   TSIMD_INLINE vdouble16 select(const vboold16 &m,
                                 const vdouble16 &t,
                                 const vdouble16 &f)
@@ -194,6 +282,159 @@ namespace tsimd {
                     select(vboold8(m.vh), vllong8(t.vh), vllong8(f.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> select(
+      const pack<bool_t<T>, W> &m, const pack<T, W> &t, const pack<T, W> &f)
+  {
+    using half_t      = pack<T, W / 2>;
+    using half_mask_t = mask<T, W / 2>;
+    return pack<T, W>(select(half_mask_t(m.vl), half_t(t.vl), half_t(f.vl)),
+                      select(half_mask_t(m.vh), half_t(t.vh), half_t(f.vh)));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> select(const pack<bool_t<T>, W> &m,
+                                 const pack<T, W> &t,
+                                 const pack<T, W> &f)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = m[i] ? t[i] : f[i];
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 select(const vboolc16 &m,
+                              const vchar16 &t,
+                              const vchar16 &f)
+  {
+    return _mm_blendv_epi8(f, t, m);
+  }
+
+  TSIMD_INLINE vuchar16 select(const vboolc16 &m,
+                               const vuchar16 &t,
+                               const vuchar16 &f)
+  {
+    return _mm_blendv_epi8(f, t, m);
+  }
+
+  TSIMD_INLINE vshort8 select(const vbools8 &m,
+                              const vshort8 &t,
+                              const vshort8 &f)
+  {
+    return _mm_blendv_epi8(f, t, m);
+  }
+
+  TSIMD_INLINE vushort8 select(const vbools8 &m,
+                               const vushort8 &t,
+                               const vushort8 &f)
+  {
+    return _mm_blendv_epi8(f, t, m);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 select(const vboolc32 &m,
+                              const vchar32 &t,
+                              const vchar32 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vchar32(select(vboolc16(m.vl), vchar16(t.vl), vchar16(f.vl)),
+                   select(vboolc16(m.vh), vchar16(t.vh), vchar16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 select(const vboolc32 &m,
+                               const vuchar32 &t,
+                               const vuchar32 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vuchar32(select(vboolc16(m.vl), vuchar16(t.vl), vuchar16(f.vl)),
+                    select(vboolc16(m.vh), vuchar16(t.vh), vuchar16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 select(const vbools16 &m,
+                               const vshort16 &t,
+                               const vshort16 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vshort16(select(vbools8(m.vl), vshort8(t.vl), vshort8(f.vl)),
+                    select(vbools8(m.vh), vshort8(t.vh), vshort8(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 select(const vbools16 &m,
+                                const vushort16 &t,
+                                const vushort16 &f)
+  {
+#if defined(__AVX2__)
+    return _mm256_blendv_epi8(f, t, m);
+#else
+    return vushort16(select(vbools8(m.vl), vushort8(t.vl), vushort8(f.vl)),
+                     select(vbools8(m.vh), vushort8(t.vh), vushort8(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 select(const vboolc64 &m,
+                              const vchar64 &t,
+                              const vchar64 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(m), f, t);
+#else
+    return vchar64(select(vboolc32(m.vl), vchar32(t.vl), vchar32(f.vl)),
+                   select(vboolc32(m.vh), vchar32(t.vh), vchar32(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 select(const vboolc64 &m,
+                               const vuchar64 &t,
+                               const vuchar64 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi8(_mm512_movepi8_mask(m), f, t);
+#else
+    return vuchar64(select(vboolc32(m.vl), vuchar32(t.vl), vuchar32(f.vl)),
+                    select(vboolc32(m.vh), vuchar32(t.vh), vuchar32(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 select(const vbools32 &m,
+                               const vshort32 &t,
+                               const vshort32 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi16(_mm512_movepi16_mask(m), f, t);
+#else
+    return vshort32(select(vbools16(m.vl), vshort16(t.vl), vshort16(f.vl)),
+                    select(vbools16(m.vh), vshort16(t.vh), vshort16(f.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 select(const vbools32 &m,
+                                const vushort32 &t,
+                                const vushort32 &f)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mask_blend_epi16(_mm512_movepi16_mask(m), f, t);
+#else
+    return vushort32(select(vbools16(m.vl), vushort16(t.vl), vushort16(f.vl)),
+                     select(vbools16(m.vh), vushort16(t.vh), vushort16(f.vh)));
+#endif
+  }
+
   // Inferred pack-scalar select //////////////////////////////////////////////
 
   template <typename T,
@@ -25,16 +25,22 @@
 #pragma once
 
 #include "math/abs.h"
+#include "math/average.h"
 #include "math/ceil.h"
 #include "math/cos.h"
+#include "math/divider.h"
 #include "math/exp.h"
 #include "math/floor.h"
+#include "math/fma.h"
 #include "math/log.h"
 #include "math/max.h"
 #include "math/min.h"
+#include "math/polynomial.h"
 #include "math/pow.h"
 #include "math/rcp.h"
 #include "math/rsqrt.h"
+#include "math/saturating_add.h"
+#include "math/saturating_sub.h"
 #include "math/sin.h"
 #include "math/sqrt.h"
 #include "math/tan.h"
@@ -38,6 +38,23 @@ namespace tsimd {
     return pack<T, 1>(std::abs(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 abs(const vdouble2 &p)
+  {
+#if defined(__SSE4_2__)
+    return _mm_and_pd(
+        p, _mm_castsi128_pd(_mm_set1_epi64x(0x7fffffffffffffffLL)));
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::abs(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 abs(const vfloat4 &p)
@@ -70,22 +87,36 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 abs(const vdouble4 &p)
   {
+#if defined(__AVX__)
+    return _mm256_and_pd(
+        p, _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL)));
+#else
+    TSIMD_SCALAR_FALLBACK("abs(vdouble4)");
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::abs(p[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vllong4 abs(const vllong4 &p)
   {
+#if defined(__AVX512VL__)
+    return _mm256_abs_epi64(p);
+#elif defined(__AVX2__)
+    const __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p);
+    return _mm256_sub_epi64(_mm256_xor_si256(p, s), s);
+#else
+    TSIMD_SCALAR_FALLBACK("abs(vllong4)");
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::abs(p[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -162,4 +193,14 @@ namespace tsimd {
     return vllong16(abs(vllong8(p.vl)), abs(vllong8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> abs(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(abs(half_t(p.vl)), abs(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
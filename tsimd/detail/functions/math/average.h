@@ -0,0 +1,164 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "../../operators/logic/greater_than.h"
+
+namespace tsimd {
+
+  // average() ////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Rounding average of 8-bit or 16-bit elements, (a + b + 1) >> 1
+  //             computed without overflowing the element type. Only unsigned
+  //             averages exist in hardware, signed elements are biased into
+  //             unsigned range and back.
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> average(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>((int(p1[i]) + int(p2[i]) + 1) >> 1);
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 average(const vchar16 &p1, const vchar16 &p2)
+  {
+    const __m128i avg = _mm_avg_epu8(detail::flip_sign_epi8(p1),
+                                     detail::flip_sign_epi8(p2));
+    return detail::flip_sign_epi8(avg);
+  }
+
+  TSIMD_INLINE vuchar16 average(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_avg_epu8(p1, p2);
+  }
+
+  TSIMD_INLINE vshort8 average(const vshort8 &p1, const vshort8 &p2)
+  {
+    const __m128i avg = _mm_avg_epu16(detail::flip_sign_epi16(p1),
+                                      detail::flip_sign_epi16(p2));
+    return detail::flip_sign_epi16(avg);
+  }
+
+  TSIMD_INLINE vushort8 average(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_avg_epu16(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 average(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    const __m256i avg = _mm256_avg_epu8(detail::flip_sign_epi8(p1),
+                                        detail::flip_sign_epi8(p2));
+    return detail::flip_sign_epi8(avg);
+#else
+    return vchar32(average(vchar16(p1.vl), vchar16(p2.vl)),
+                   average(vchar16(p1.vh), vchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 average(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_avg_epu8(p1, p2);
+#else
+    return vuchar32(average(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    average(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 average(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    const __m256i avg = _mm256_avg_epu16(detail::flip_sign_epi16(p1),
+                                         detail::flip_sign_epi16(p2));
+    return detail::flip_sign_epi16(avg);
+#else
+    return vshort16(average(vshort8(p1.vl), vshort8(p2.vl)),
+                    average(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 average(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_avg_epu16(p1, p2);
+#else
+    return vushort16(average(vushort8(p1.vl), vushort8(p2.vl)),
+                     average(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 average(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    const __m512i avg = _mm512_avg_epu8(detail::flip_sign_epi8(p1),
+                                        detail::flip_sign_epi8(p2));
+    return detail::flip_sign_epi8(avg);
+#else
+    return vchar64(average(vchar32(p1.vl), vchar32(p2.vl)),
+                   average(vchar32(p1.vh), vchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 average(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_avg_epu8(p1, p2);
+#else
+    return vuchar64(average(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    average(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 average(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    const __m512i avg = _mm512_avg_epu16(detail::flip_sign_epi16(p1),
+                                         detail::flip_sign_epi16(p2));
+    return detail::flip_sign_epi16(avg);
+#else
+    return vshort32(average(vshort16(p1.vl), vshort16(p2.vl)),
+                    average(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 average(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_avg_epu16(p1, p2);
+#else
+    return vushort32(average(vushort16(p1.vl), vushort16(p2.vl)),
+                     average(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+}  // namespace tsimd
@@ -38,6 +38,22 @@ namespace tsimd {
     return pack<T, 1>(std::ceil(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 ceil(const vdouble2 &p)
+  {
+#if defined(__SSE4_2__)
+    return _mm_ceil_pd(p);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::ceil(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 ceil(const vfloat4 &p)
@@ -104,4 +120,14 @@ namespace tsimd {
     return vdouble16(ceil(vdouble8(p.vl)), ceil(vdouble8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> ceil(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(ceil(half_t(p.vl)), ceil(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
@@ -31,6 +31,7 @@
 #include "../algorithm/select.h"
 
 #include "floor.h"
+#include "sin.h"
 
 namespace tsimd {
 
@@ -45,51 +46,85 @@ namespace tsimd {
     return result;
   }
 
+  // fast_cos() ///////////////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_cos(const pack<T, W> &p)
+  {
+    return cos(p);
+  }
+
+  // NOTE(jda) - reduced precision version, max absolute error is ~4e-5
+  template <int W>
+  TSIMD_INLINE vfloatn<W> fast_cos(const vfloatn<W> &p)
+  {
+    vfloatn<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8.f * floor(y * 0.125f);
+
+    const auto flipSign = j > 3.f;
+    j = select(flipSign, j - 4.f, j);
+
+    const auto useSin = (j == 1.f) | (j == 2.f);
+
+    auto result = select(
+        useSin, detail::fast_sin_pio4(r, z), detail::fast_cos_pio4(z));
+    result = select(flipSign, -result, result);
+    return select(j > 1.f, -result, result);
+  }
+
+  // cos() ////////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - max error is 2 ULP for |x| < pi, beyond that the absolute
+  //             error stays ~1e-7 up to |x| ~ 8192
   template <int W>
   TSIMD_INLINE vfloatn<W> cos(const vfloatn<W> &p)
   {
-    static const float piOverTwoVec = 1.57079637050628662109375;
-    static const float twoOverPiVec = 0.636619746685028076171875;
-    const auto scaled = p * twoOverPiVec;
-    const auto kReal = floor(scaled);
-    const auto k = vintn<W>(kReal);
-
-    // Reduced range version of x
-    const auto x = p - kReal * piOverTwoVec;
-
-    const auto kMod4 = k & 3;
-    const auto cosUseCos = ((kMod4 == 0) | (kMod4 == 2));
-    const auto flipSign = ((kMod4 == 1) | (kMod4 == 2));
-
-    static const float sinC2 = -0.16666667163372039794921875;
-    static const float sinC4 = 8.333347737789154052734375e-3;
-    static const float sinC6 = -1.9842604524455964565277099609375e-4;
-    static const float sinC8 = 2.760012648650445044040679931640625e-6;
-    static const float sinC10 = -2.50293279435709337121807038784027099609375e-8;
-
-    static const float cosC2 = -0.5;
-    static const float cosC4 = 4.166664183139801025390625e-2;
-    static const float cosC6 = -1.388833043165504932403564453125e-3;
-    static const float cosC8 = 2.47562347794882953166961669921875e-5;
-    static const float cosC10 = -2.59630184018533327616751194000244140625e-7;
-
-    const auto outside = select(cosUseCos, 1., x);
-    const auto c2 = select(cosUseCos, vfloatn<W>(cosC2), vfloatn<W>(sinC2));
-    const auto c4 = select(cosUseCos, vfloatn<W>(cosC4), vfloatn<W>(sinC4));
-    const auto c6 = select(cosUseCos, vfloatn<W>(cosC6), vfloatn<W>(sinC6));
-    const auto c8 = select(cosUseCos, vfloatn<W>(cosC8), vfloatn<W>(sinC8));
-    const auto c10 = select(cosUseCos, vfloatn<W>(cosC10), vfloatn<W>(sinC10));
-
-    const auto x2 = x * x;
-    auto formula = x2 * c10 + c8;
-    formula = x2 * formula + c6;
-    formula = x2 * formula + c4;
-    formula = x2 * formula + c2;
-    formula = x2 * formula + 1.;
-    formula *= outside;
-
-    formula = select(flipSign, -formula, formula);
-    return formula;
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST
+    return fast_cos(p);
+#else
+    vfloatn<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8.f * floor(y * 0.125f);
+
+    const auto flipSign = j > 3.f;
+    j = select(flipSign, j - 4.f, j);
+
+    const auto useSin = (j == 1.f) | (j == 2.f);
+
+    auto result = select(
+        useSin, detail::sin_pio4(r, z), detail::cos_pio4(z));
+    result = select(flipSign, -result, result);
+    return select(j > 1.f, -result, result);
+#endif
+  }
+
+  // Double precision version of cos(), max error is ~1 ULP for |x| < 2^30
+  template <int W>
+  TSIMD_INLINE vdoublen<W> cos(const vdoublen<W> &p)
+  {
+    vdoublen<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8. * floor(y * 0.125);
+
+    auto flipSign = j > 3.;
+    j = select(flipSign, j - 4., j);
+
+    const auto useSin = (j == 1.) | (j == 2.);
+
+    auto result =
+        select(useSin, detail::sin_pio4(r, z), detail::cos_pio4(z));
+    result = select(flipSign, -result, result);
+    return select(j > 1., -result, result);
   }
 
 #if TSIMD_COMPILER_INTEL
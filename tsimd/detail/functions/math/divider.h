@@ -0,0 +1,570 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+#include <type_traits>
+
+#include "../../pack.h"
+
+#include "abs.h"
+
+#include "../algorithm/select.h"
+#include "../../operators/bitwise/right_shift.h"
+
+namespace tsimd {
+
+  // divider<> ////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Precomputes a magic multiplier and shift for a divisor which
+  //             stays the same over many divisions (Granlund & Montgomery,
+  //             the same scheme libdivide uses). 'p / d' and 'p % d' then
+  //             become a high multiply, a couple of adds and uniform shifts
+  //             instead of a per-lane scalar division. The divisor must not
+  //             be zero.
+
+  template <typename T>
+  struct divider
+  {
+    static_assert(traits::is_wide_integer<T>::value,
+                  "tsimd::divider<> only supports 'int', 'unsigned int' and "
+                  "'long long' divisors.");
+
+    explicit divider(T d);
+
+    T divisor() const;
+    T multiplier() const;
+
+    int pre_shift() const;
+    int post_shift() const;
+
+    float reciprocal() const;
+
+  private:
+
+    T d;
+    T magic;
+    int shift1;
+    int shift2;
+    float rcp;
+  };
+
+  namespace detail {
+
+    // Magic number construction //
+
+    // NOTE(jda) - floor(2^e / d) with e < 128, computed by long division so
+    //             the 64-bit magic numbers don't need 128-bit integers. Bits
+    //             of the quotient above bit 63 are dropped, which is what the
+    //             signed magic numbers want anyway (they are taken mod 2^N).
+
+    TSIMD_INLINE unsigned long long pow2_div(int e, unsigned long long d)
+    {
+      unsigned long long q = 0, r = 0;
+
+      for (int i = 127; i >= 0; --i) {
+        r = (r << 1) | (i == e ? 1 : 0);
+        q <<= 1;
+        if (r >= d) {
+          r -= d;
+          q |= 1;
+        }
+      }
+
+      return q;
+    }
+
+    TSIMD_INLINE int ceil_log2(unsigned long long x)
+    {
+      int l = 0;
+      while (l < 64 && (1ull << l) < x)
+        ++l;
+      return l;
+    }
+
+    // round-up method for unsigned divisors: the magic number needs N + 1
+    // bits, so the extra one is added back in with '(n - t) >> 1'
+    TSIMD_INLINE void compute_magic(unsigned int d,
+                                    unsigned int &magic,
+                                    int &shift1,
+                                    int &shift2)
+    {
+      const int l = ceil_log2(d);
+      magic  = static_cast<unsigned int>(pow2_div(32 + l, d) + 1);
+      shift1 = l < 1 ? l : 1;
+      shift2 = l > 1 ? l - 1 : 0;
+    }
+
+    template <typename T>
+    TSIMD_INLINE void compute_signed_magic(T d, T &magic, int &shift2)
+    {
+      const int N = sizeof(T) * 8;
+
+      const unsigned long long ad =
+          d < 0 ? 0ull - static_cast<unsigned long long>(d)
+                : static_cast<unsigned long long>(d);
+
+      int l = ceil_log2(ad);
+      l     = l < 1 ? 1 : l;
+
+      magic  = static_cast<T>(pow2_div(N - 1 + l, ad) + 1);
+      shift2 = l - 1;
+    }
+
+    TSIMD_INLINE void compute_magic(int d,
+                                    int &magic,
+                                    int &shift1,
+                                    int &shift2)
+    {
+      shift1 = 0;
+      compute_signed_magic(d, magic, shift2);
+    }
+
+    TSIMD_INLINE void compute_magic(long long d,
+                                    long long &magic,
+                                    int &shift1,
+                                    int &shift2)
+    {
+      shift1 = 0;
+      compute_signed_magic(d, magic, shift2);
+    }
+
+    // mulhi() - upper half of the full width product //
+
+    TSIMD_INLINE int mulhi(int a, int b)
+    {
+      return static_cast<int>((static_cast<long long>(a) * b) >> 32);
+    }
+
+    TSIMD_INLINE unsigned int mulhi(unsigned int a, unsigned int b)
+    {
+      return static_cast<unsigned int>(
+          (static_cast<unsigned long long>(a) * b) >> 32);
+    }
+
+    // NOTE(jda) - 64x64 bit high multiplies are built from four 32x32->64
+    //             bit products, then corrected for the signs of a and b.
+
+    TSIMD_INLINE long long mulhi(long long a, long long b)
+    {
+      const unsigned long long ua = a, ub = b;
+
+      const unsigned long long a_lo = ua & 0xFFFFFFFF, a_hi = ua >> 32;
+      const unsigned long long b_lo = ub & 0xFFFFFFFF, b_hi = ub >> 32;
+
+      const unsigned long long t  = a_hi * b_lo + ((a_lo * b_lo) >> 32);
+      const unsigned long long w1 = (t & 0xFFFFFFFF) + a_lo * b_hi;
+
+      unsigned long long hi = a_hi * b_hi + (t >> 32) + (w1 >> 32);
+
+      if (a < 0)
+        hi -= ub;
+      if (b < 0)
+        hi -= ua;
+
+      return static_cast<long long>(hi);
+    }
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i mulhi_epi32(__m128i a, __m128i b)
+    {
+      const __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, b), 32);
+      const __m128i odd =
+          _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+      return _mm_blend_epi16(even, odd, 0xCC);
+    }
+
+    TSIMD_INLINE __m128i mulhi_epu32(__m128i a, __m128i b)
+    {
+      const __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, b), 32);
+      const __m128i odd =
+          _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+      return _mm_blend_epi16(even, odd, 0xCC);
+    }
+
+    TSIMD_INLINE __m128i mulhi_epi64(__m128i a, __m128i b)
+    {
+      const __m128i a_hi = _mm_srli_epi64(a, 32);
+      const __m128i b_hi = _mm_srli_epi64(b, 32);
+
+      const __m128i t = _mm_add_epi64(
+          _mm_mul_epu32(a_hi, b), _mm_srli_epi64(_mm_mul_epu32(a, b), 32));
+      const __m128i w1 =
+          _mm_add_epi64(_mm_and_si128(t, _mm_set1_epi64x(0xFFFFFFFF)),
+                        _mm_mul_epu32(a, b_hi));
+
+      const __m128i hi = _mm_add_epi64(
+          _mm_add_epi64(_mm_mul_epu32(a_hi, b_hi), _mm_srli_epi64(t, 32)),
+          _mm_srli_epi64(w1, 32));
+
+      const __m128i zero = _mm_setzero_si128();
+      return _mm_sub_epi64(
+          _mm_sub_epi64(hi, _mm_and_si128(_mm_cmpgt_epi64(zero, a), b)),
+          _mm_and_si128(_mm_cmpgt_epi64(zero, b), a));
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i mulhi_epi32(__m256i a, __m256i b)
+    {
+      const __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, b), 32);
+      const __m256i odd  = _mm256_mul_epi32(_mm256_srli_epi64(a, 32),
+                                           _mm256_srli_epi64(b, 32));
+      return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    TSIMD_INLINE __m256i mulhi_epu32(__m256i a, __m256i b)
+    {
+      const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32);
+      const __m256i odd  = _mm256_mul_epu32(_mm256_srli_epi64(a, 32),
+                                           _mm256_srli_epi64(b, 32));
+      return _mm256_blend_epi32(even, odd, 0xAA);
+    }
+
+    TSIMD_INLINE __m256i mulhi_epi64(__m256i a, __m256i b)
+    {
+      const __m256i a_hi = _mm256_srli_epi64(a, 32);
+      const __m256i b_hi = _mm256_srli_epi64(b, 32);
+
+      const __m256i t =
+          _mm256_add_epi64(_mm256_mul_epu32(a_hi, b),
+                           _mm256_srli_epi64(_mm256_mul_epu32(a, b), 32));
+      const __m256i w1 = _mm256_add_epi64(
+          _mm256_and_si256(t, _mm256_set1_epi64x(0xFFFFFFFF)),
+          _mm256_mul_epu32(a, b_hi));
+
+      const __m256i hi = _mm256_add_epi64(
+          _mm256_add_epi64(_mm256_mul_epu32(a_hi, b_hi),
+                           _mm256_srli_epi64(t, 32)),
+          _mm256_srli_epi64(w1, 32));
+
+      const __m256i zero = _mm256_setzero_si256();
+      return _mm256_sub_epi64(
+          _mm256_sub_epi64(
+              hi, _mm256_and_si256(_mm256_cmpgt_epi64(zero, a), b)),
+          _mm256_and_si256(_mm256_cmpgt_epi64(zero, b), a));
+    }
+#endif
+
+#if defined(__AVX512F__)
+    TSIMD_INLINE __m512i mulhi_epi32(__m512i a, __m512i b)
+    {
+      const __m512i even = _mm512_srli_epi64(_mm512_mul_epi32(a, b), 32);
+      const __m512i odd  = _mm512_mul_epi32(_mm512_srli_epi64(a, 32),
+                                           _mm512_srli_epi64(b, 32));
+      return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    }
+
+    TSIMD_INLINE __m512i mulhi_epu32(__m512i a, __m512i b)
+    {
+      const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32);
+      const __m512i odd  = _mm512_mul_epu32(_mm512_srli_epi64(a, 32),
+                                           _mm512_srli_epi64(b, 32));
+      return _mm512_mask_blend_epi32(0xAAAA, even, odd);
+    }
+
+    TSIMD_INLINE __m512i mulhi_epi64(__m512i a, __m512i b)
+    {
+      const __m512i a_hi = _mm512_srli_epi64(a, 32);
+      const __m512i b_hi = _mm512_srli_epi64(b, 32);
+
+      const __m512i t =
+          _mm512_add_epi64(_mm512_mul_epu32(a_hi, b),
+                           _mm512_srli_epi64(_mm512_mul_epu32(a, b), 32));
+      const __m512i w1 = _mm512_add_epi64(
+          _mm512_and_si512(t, _mm512_set1_epi64(0xFFFFFFFF)),
+          _mm512_mul_epu32(a, b_hi));
+
+      __m512i hi = _mm512_add_epi64(
+          _mm512_add_epi64(_mm512_mul_epu32(a_hi, b_hi),
+                           _mm512_srli_epi64(t, 32)),
+          _mm512_srli_epi64(w1, 32));
+
+      const __m512i zero = _mm512_setzero_si512();
+      hi = _mm512_mask_sub_epi64(hi, _mm512_cmplt_epi64_mask(a, zero), hi, b);
+      return _mm512_mask_sub_epi64(
+          hi, _mm512_cmplt_epi64_mask(b, zero), hi, a);
+    }
+#endif
+
+    template <typename T, int W>
+    TSIMD_INLINE traits::unsplit_pack_result_t<T, W, pack<T, W>> mulhi(
+        const pack<T, W> &p1, const pack<T, W> &p2)
+    {
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i)
+        result[i] = mulhi(p1[i], p2[i]);
+
+      return result;
+    }
+
+    // 2-wide //
+
+    TSIMD_INLINE vllong2 mulhi(const vllong2 &p1, const vllong2 &p2)
+    {
+#if defined(__SSE4_2__)
+      return mulhi_epi64(p1, p2);
+#else
+      vllong2 result;
+
+      for (int i = 0; i < 2; ++i)
+        result[i] = mulhi(p1[i], p2[i]);
+
+      return result;
+#endif
+    }
+
+    // 4-wide //
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE vint4 mulhi(const vint4 &p1, const vint4 &p2)
+    {
+      return mulhi_epi32(p1, p2);
+    }
+
+    TSIMD_INLINE vuint4 mulhi(const vuint4 &p1, const vuint4 &p2)
+    {
+      return mulhi_epu32(p1, p2);
+    }
+#endif
+
+    TSIMD_INLINE vllong4 mulhi(const vllong4 &p1, const vllong4 &p2)
+    {
+#if defined(__AVX2__)
+      return mulhi_epi64(p1, p2);
+#else
+      return vllong4(mulhi(vllong2(p1.vl), vllong2(p2.vl)),
+                     mulhi(vllong2(p1.vh), vllong2(p2.vh)));
+#endif
+    }
+
+    // 8-wide //
+
+    TSIMD_INLINE vint8 mulhi(const vint8 &p1, const vint8 &p2)
+    {
+#if defined(__AVX2__)
+      return mulhi_epi32(p1, p2);
+#elif defined(__AVX__)
+      return vint8(mulhi_epi32(p1.vl, p2.vl), mulhi_epi32(p1.vh, p2.vh));
+#else
+      return vint8(mulhi(vint4(p1.vl), vint4(p2.vl)),
+                   mulhi(vint4(p1.vh), vint4(p2.vh)));
+#endif
+    }
+
+    TSIMD_INLINE vuint8 mulhi(const vuint8 &p1, const vuint8 &p2)
+    {
+#if defined(__AVX2__)
+      return mulhi_epu32(p1, p2);
+#elif defined(__AVX__)
+      return vuint8(mulhi_epu32(p1.vl, p2.vl), mulhi_epu32(p1.vh, p2.vh));
+#else
+      return vuint8(mulhi(vuint4(p1.vl), vuint4(p2.vl)),
+                    mulhi(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+    }
+
+    TSIMD_INLINE vllong8 mulhi(const vllong8 &p1, const vllong8 &p2)
+    {
+#if defined(__AVX512F__)
+      return mulhi_epi64(p1, p2);
+#else
+      return vllong8(mulhi(vllong4(p1.vl), vllong4(p2.vl)),
+                     mulhi(vllong4(p1.vh), vllong4(p2.vh)));
+#endif
+    }
+
+    // 16-wide //
+
+    TSIMD_INLINE vint16 mulhi(const vint16 &p1, const vint16 &p2)
+    {
+#if defined(__AVX512F__)
+      return mulhi_epi32(p1, p2);
+#else
+      return vint16(mulhi(vint8(p1.vl), vint8(p2.vl)),
+                    mulhi(vint8(p1.vh), vint8(p2.vh)));
+#endif
+    }
+
+    TSIMD_INLINE vuint16 mulhi(const vuint16 &p1, const vuint16 &p2)
+    {
+#if defined(__AVX512F__)
+      return mulhi_epu32(p1, p2);
+#else
+      return vuint16(mulhi(vuint8(p1.vl), vuint8(p2.vl)),
+                     mulhi(vuint8(p1.vh), vuint8(p2.vh)));
+#endif
+    }
+
+    TSIMD_INLINE vllong16 mulhi(const vllong16 &p1, const vllong16 &p2)
+    {
+      return vllong16(mulhi(vllong8(p1.vl), vllong8(p2.vl)),
+                      mulhi(vllong8(p1.vh), vllong8(p2.vh)));
+    }
+
+    // 2-wide, 32-wide, and 64-wide //
+
+    template <typename T, int W>
+    TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> mulhi(
+        const pack<T, W> &p1, const pack<T, W> &p2)
+    {
+      using half_t = pack<T, W / 2>;
+      return pack<T, W>(mulhi(half_t(p1.vl), half_t(p2.vl)),
+                        mulhi(half_t(p1.vh), half_t(p2.vh)));
+    }
+
+  }  // namespace detail
+
+  // binary operator/() ///////////////////////////////////////////////////////
+
+  // unsigned: q = (t + ((n - t) >> shift1)) >> shift2, with t = mulhi(n, m)
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::enable_if_t<std::is_unsigned<T>::value, pack<T, W>>
+  operator/(const pack<T, W> &p, const divider<T> &d)
+  {
+    const auto t = detail::mulhi(p, pack<T, W>(d.multiplier()));
+    return (t + ((p - t) >> d.pre_shift())) >> d.post_shift();
+  }
+
+  // signed: q = ((n + mulhi(n, m)) >> shift2) - (n >> (N - 1)), then the
+  // sign of the divisor is applied with '(q ^ s) - s'
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::enable_if_t<std::is_signed<T>::value, pack<T, W>>
+  operator/(const pack<T, W> &p, const divider<T> &d)
+  {
+    const int N = sizeof(T) * 8;
+
+    const auto q = ((p + detail::mulhi(p, pack<T, W>(d.multiplier()))) >>
+                    d.post_shift()) -
+                   (p >> (N - 1));
+
+    const pack<T, W> s(d.divisor() < 0 ? T(-1) : T(0));
+    return (q ^ s) - s;
+  }
+
+  // binary operator%() ///////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> operator%(const pack<T, W> &p, const divider<T> &d)
+  {
+    return p - (p / d) * pack<T, W>(d.divisor());
+  }
+
+  // Inferred binary operator/=() and operator%=() ////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator/=(pack<T, W> &p, const divider<T> &d)
+  {
+    return p = (p / d);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> &operator%=(pack<T, W> &p, const divider<T> &d)
+  {
+    return p = (p % d);
+  }
+
+  // fast_divide() / fast_modulo() ////////////////////////////////////////////
+
+  // NOTE(jda) - 32-bit only: divides through the float reciprocal of the
+  //             divisor and fixes the truncated quotient up by one in either
+  //             direction. This is exact as long as |p| < 2^24 (e.g. grid or
+  //             table indices) and |d| < 2^31, and cheaper than the high
+  //             multiply.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_divide(const pack<T, W> &p, const divider<T> &d)
+  {
+    static_assert(sizeof(T) == 4,
+                  "tsimd::fast_divide() only supports 32-bit elements.");
+
+    using vint_t   = pack<int, W>;
+    using vfloat_t = pack<float, W>;
+
+    const int dv = static_cast<int>(d.divisor());
+    const vint_t ad(dv < 0 ? -dv : dv);
+
+    const vint_t n  = reinterpret_elements_as<int>(p);
+    const vint_t an = abs(n);
+
+    vint_t q = vint_t(vfloat_t(an) * d.reciprocal());
+
+    const vint_t r = an - q * ad;
+    q = select(r < 0, q - 1, q);
+    q = select(r >= ad, q + 1, q);
+
+    const vint_t s = (n >> 31) ^ vint_t(dv < 0 ? -1 : 0);
+    return reinterpret_elements_as<T>((q ^ s) - s);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_modulo(const pack<T, W> &p, const divider<T> &d)
+  {
+    return p - fast_divide(p, d) * pack<T, W>(d.divisor());
+  }
+
+  // Inlined definitions //////////////////////////////////////////////////////
+
+  template <typename T>
+  TSIMD_INLINE divider<T>::divider(T _d) : d(_d)
+  {
+    detail::compute_magic(d, magic, shift1, shift2);
+    rcp = 1.f / std::abs(static_cast<float>(d));
+  }
+
+  template <typename T>
+  TSIMD_INLINE T divider<T>::divisor() const
+  {
+    return d;
+  }
+
+  template <typename T>
+  TSIMD_INLINE T divider<T>::multiplier() const
+  {
+    return magic;
+  }
+
+  template <typename T>
+  TSIMD_INLINE int divider<T>::pre_shift() const
+  {
+    return shift1;
+  }
+
+  template <typename T>
+  TSIMD_INLINE int divider<T>::post_shift() const
+  {
+    return shift2;
+  }
+
+  template <typename T>
+  TSIMD_INLINE float divider<T>::reciprocal() const
+  {
+    return rcp;
+  }
+
+}  // namespace tsimd
@@ -25,10 +25,15 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "../../pack.h"
 
 #include "floor.h"
+#include "fma.h"
+#include "polynomial.h"
+
+#include "../../operators/bitwise/left_shift.h"
 
 #include "../algorithm/select.h"
 
@@ -54,33 +59,58 @@ namespace tsimd {
       vintn<W> ix = reinterpret_elements_as<int>(x);
       ex &= ix;              // extract old exponent;
       ix = ix & ~0x7F800000u;  // clear exponent
-      n = (n << 23) + ex;
+      n = shift_left<23>(n) + ex;
       ix |= n; // insert new exponent
       return reinterpret_elements_as<float>(ix);
     }
 
+    // 2^k for integer valued k in [-1022, 1023]: adding 2^52 + 1023 leaves
+    // the biased exponent in the low mantissa bits, which are then shifted up
+    // into the exponent field.
+    template <int W>
+    TSIMD_INLINE vdoublen<W> pow2(const vdoublen<W> &k)
+    {
+      const auto bits =
+          reinterpret_elements_as<long long>(k + 4503599627371519.0);
+      return reinterpret_elements_as<double>(shift_left<52>(bits));
+    }
+
   } // namespace detail
 
+  // fast_exp() ///////////////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_exp(const pack<T, W> &p)
+  {
+    return exp(p);
+  }
+
+  // NOTE(jda) - reduced precision version: max relative error is ~1.5e-5 (16
+  //             bits) and there is no overflow/underflow handling, so inputs
+  //             must lie in [-87, 88].
   template <int W>
   TSIMD_INLINE vfloatn<W> fast_exp(vfloatn<W> p)
   {
     auto z = floor(1.44269504088896341f * p + 0.5f);
-    p -= z * 0.693359375f;
-    p -= z * -2.12194440e-4f;
+    p = fnma(z, vfloatn<W>(0.693359375f), p);
+    p = fnma(z, vfloatn<W>(-2.12194440e-4f), p);
     auto n = vintn<W>(z);
 
-    z = p * p;
-    z = (((((1.9875691500E-4f  * p + 1.3981999507E-3f) * p +
-            8.3334519073E-3f) * p + 4.1665795894E-2f) * p +
-          1.6666665459E-1f) * p + 5.0000001201E-1f) * z + p + 1.f;
-    p = detail::ldexp(z, n);
-    return p;
+    z = horner(p, 4.99997489e-1f, 1.67419166e-1f, 4.18338265e-2f);
+    z = fma(z, p * p, p + 1.f);
+    return detail::ldexp(z, n);
   }
 
-#if 1
+  // exp() ////////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - max error is 2 ULP, overflows to +inf above ~88.7 and flushes
+  //             to zero below ~-87.3
   template <int W>
   TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
   {
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST
+    return fast_exp(p);
+#else
     const vfloatn<W> ln2_part1(0.6931457519);
     const vfloatn<W> ln2_part2(1.4286067653e-6);
     const vfloatn<W> one_over_ln2(1.44269502162933349609375);
@@ -90,25 +120,19 @@ namespace tsimd {
     vintn<W> k(k_real);
 
     // Reduced range version of x
-    auto x = p - k_real * ln2_part1;
-    x -= k_real * ln2_part2;
+    auto x = fnma(k_real, ln2_part1, p);
+    x      = fnma(k_real, ln2_part2, x);
 
     // These coefficients are for e^x in [0, ln(2)]
-    const vfloatn<W> one(1.);
-    const vfloatn<W> c2(0.4999999105930328369140625);
-    const vfloatn<W> c3(0.166668415069580078125);
-    const vfloatn<W> c4(4.16539050638675689697265625e-2);
-    const vfloatn<W> c5(8.378830738365650177001953125e-3);
-    const vfloatn<W> c6(1.304379315115511417388916015625e-3);
-    const vfloatn<W> c7(2.7555381529964506626129150390625e-4);
-
-    auto result = x * c7 + c6;
-    result = x * result + c5;
-    result = x * result + c4;
-    result = x * result + c3;
-    result = x * result + c2;
-    result = x * result + one;
-    result = x * result + one;
+    auto result = horner(x,
+                         1.f,
+                         1.f,
+                         0.4999999105930328369140625f,
+                         0.166668415069580078125f,
+                         4.16539050638675689697265625e-2f,
+                         8.378830738365650177001953125e-3f,
+                         1.304379315115511417388916015625e-3f,
+                         2.7555381529964506626129150390625e-4f);
 
     // Compute 2^k (should differ for float and double, but I'll avoid
     // it for now and just do floats)
@@ -120,7 +144,7 @@ namespace tsimd {
     // negative float input that doesn't result in zero is like -88.
     auto underflow = (biased_n <= 0);
     const vintn<W> InfBits(0x7f800000);
-    biased_n = biased_n << 23;
+    biased_n = shift_left<23>(biased_n);
     // Reinterpret this thing as float
     vfloatn<W> two_to_the_n = reinterpret_elements_as<float>(biased_n);
     // Handle both doubles and floats (hopefully eliding the copy for float)
@@ -129,13 +153,52 @@ namespace tsimd {
     result = select(overflow, reinterpret_elements_as<float>(InfBits), result);
     result = select(underflow, 0., result);
     return result;
+#endif
   }
-#else
+
+  // Double precision version of exp() from Cephes: reduce to x = k*ln(2) + r
+  // with |r| <= ln(2)/2 and use the Pade form
+  // e^r = 1 + 2r*P(r^2) / (Q(r^2) - r*P(r^2)). Max error is ~1 ULP.
   template <int W>
-  TSIMD_INLINE vfloatn<W> exp(const vfloatn<W> &p)
+  TSIMD_INLINE vdoublen<W> exp(const vdoublen<W> &p)
   {
-    return fast_exp(p);
+    const auto overflow  = p > 709.782712893383973096;
+    const auto underflow = p < -745.133219101941108420;
+
+    const auto x = select(overflow | underflow, vdoublen<W>(0.), p);
+
+    const auto k = floor(x * 1.4426950408889634073599 + 0.5);
+
+    // ln(2) split in two so that k * ln2_part1 is exact
+    auto r = fnma(k, vdoublen<W>(6.93145751953125e-1), x);
+    r      = fnma(k, vdoublen<W>(1.42860682030941723212e-6), r);
+
+    const auto r2 = r * r;
+
+    const auto px = r * horner(r2,
+                               9.99999999999999999910e-1,
+                               3.02994407707441961300e-2,
+                               1.26177193074810590878e-4);
+
+    const auto qx = horner(r2,
+                           2.00000000000000000009e0,
+                           2.27265548208155028766e-1,
+                           2.52448340349684104192e-3,
+                           3.00198505138664455042e-6);
+
+    auto result = px / (qx - px);
+    result      = result + result + 1.;
+
+    // k lies in [-1075, 1024], so apply 2^k in two steps to keep each factor
+    // a normal double
+    const auto k1 = floor(k * 0.5);
+    result *= detail::pow2(k1);
+    result *= detail::pow2(k - k1);
+
+    result = select(overflow,
+                    vdoublen<W>(std::numeric_limits<double>::infinity()),
+                    result);
+    return select(underflow, vdoublen<W>(0.), result);
   }
-#endif
 
 }  // namespace tsimd
@@ -38,6 +38,22 @@ namespace tsimd {
     return pack<T, 1>(std::floor(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 floor(const vdouble2 &p)
+  {
+#if defined(__SSE4_2__)
+    return _mm_floor_pd(p);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::floor(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 floor(const vfloat4 &p)
@@ -104,4 +120,14 @@ namespace tsimd {
     return vdouble16(floor(vdouble8(p.vl)), floor(vdouble8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> floor(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(floor(half_t(p.vl)), floor(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
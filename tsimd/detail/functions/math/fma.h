@@ -0,0 +1,554 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cmath>
+
+#include "../../pack.h"
+
+#include "../../operators/arithmetic/minus.h"
+#include "../../operators/arithmetic/plus.h"
+#include "../../operators/arithmetic/times.h"
+
+namespace tsimd {
+
+  // NOTE(jda) - fma(a, b, c)  =   a * b + c
+  //             fms(a, b, c)  =   a * b - c
+  //             fnma(a, b, c) = -(a * b) + c
+  //             fnms(a, b, c) = -(a * b) - c
+  //
+  //             With FMA3 (or AVX512F for the 512-bit types) these are a
+  //             single instruction with a single rounding, otherwise they
+  //             fall back to a separate multiply and add/subtract.
+
+  // fma() ////////////////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fma(const pack<T, 1> &p1,
+                              const pack<T, 1> &p2,
+                              const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(p1[0], p2[0], p3[0]));
+#else
+    return pack<T, 1>(p1[0] * p2[0] + p3[0]);
+#endif
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 fma(const vdouble2 &p1,
+                            const vdouble2 &p2,
+                            const vdouble2 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmadd_pd(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fma(const vfloat4 &p1,
+                           const vfloat4 &p2,
+                           const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmadd_ps(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fma(const vdouble4 &p1,
+                            const vdouble4 &p2,
+                            const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_pd(p1, p2, p3);
+#else
+    return p1 * p2 + p3;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fma(const vfloat8 &p1,
+                           const vfloat8 &p2,
+                           const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmadd_ps(p1, p2, p3);
+#elif defined(__AVX__)
+    return p1 * p2 + p3;
+#else
+    return vfloat8(fma(vfloat4(p1.vl), vfloat4(p2.vl), vfloat4(p3.vl)),
+                   fma(vfloat4(p1.vh), vfloat4(p2.vh), vfloat4(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fma(const vdouble8 &p1,
+                            const vdouble8 &p2,
+                            const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmadd_pd(p1, p2, p3);
+#else
+    return vdouble8(fma(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fma(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fma(const vfloat16 &p1,
+                            const vfloat16 &p2,
+                            const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmadd_ps(p1, p2, p3);
+#else
+    return vfloat16(fma(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fma(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fma(const vdouble16 &p1,
+                             const vdouble16 &p2,
+                             const vdouble16 &p3)
+  {
+    return vdouble16(fma(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fma(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> fma(
+      const pack<T, W> &p1, const pack<T, W> &p2, const pack<T, W> &p3)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(fma(half_t(p1.vl), half_t(p2.vl), half_t(p3.vl)),
+                      fma(half_t(p1.vh), half_t(p2.vh), half_t(p3.vh)));
+  }
+
+  // Inferred pack<>/scalar versions //
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::valid_pack_scalar_operator_t<T, OTHER_T>>
+  TSIMD_INLINE pack<T, W> fma(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const OTHER_T &v)
+  {
+    return fma(p1, p2, pack<T, W>(v));
+  }
+
+  // fms() ////////////////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fms(const pack<T, 1> &p1,
+                              const pack<T, 1> &p2,
+                              const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(p1[0], p2[0], -p3[0]));
+#else
+    return pack<T, 1>(p1[0] * p2[0] - p3[0]);
+#endif
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 fms(const vdouble2 &p1,
+                            const vdouble2 &p2,
+                            const vdouble2 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmsub_pd(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fms(const vfloat4 &p1,
+                           const vfloat4 &p2,
+                           const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fmsub_ps(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fms(const vdouble4 &p1,
+                            const vdouble4 &p2,
+                            const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmsub_pd(p1, p2, p3);
+#else
+    return p1 * p2 - p3;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fms(const vfloat8 &p1,
+                           const vfloat8 &p2,
+                           const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fmsub_ps(p1, p2, p3);
+#elif defined(__AVX__)
+    return p1 * p2 - p3;
+#else
+    return vfloat8(fms(vfloat4(p1.vl), vfloat4(p2.vl), vfloat4(p3.vl)),
+                   fms(vfloat4(p1.vh), vfloat4(p2.vh), vfloat4(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fms(const vdouble8 &p1,
+                            const vdouble8 &p2,
+                            const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmsub_pd(p1, p2, p3);
+#else
+    return vdouble8(fms(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fms(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fms(const vfloat16 &p1,
+                            const vfloat16 &p2,
+                            const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fmsub_ps(p1, p2, p3);
+#else
+    return vfloat16(fms(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fms(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fms(const vdouble16 &p1,
+                             const vdouble16 &p2,
+                             const vdouble16 &p3)
+  {
+    return vdouble16(fms(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fms(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> fms(
+      const pack<T, W> &p1, const pack<T, W> &p2, const pack<T, W> &p3)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(fms(half_t(p1.vl), half_t(p2.vl), half_t(p3.vl)),
+                      fms(half_t(p1.vh), half_t(p2.vh), half_t(p3.vh)));
+  }
+
+  // Inferred pack<>/scalar versions //
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::valid_pack_scalar_operator_t<T, OTHER_T>>
+  TSIMD_INLINE pack<T, W> fms(const pack<T, W> &p1,
+                              const pack<T, W> &p2,
+                              const OTHER_T &v)
+  {
+    return fms(p1, p2, pack<T, W>(v));
+  }
+
+  // fnma() ///////////////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fnma(const pack<T, 1> &p1,
+                               const pack<T, 1> &p2,
+                               const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(std::fma(-p1[0], p2[0], p3[0]));
+#else
+    return pack<T, 1>(p3[0] - p1[0] * p2[0]);
+#endif
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 fnma(const vdouble2 &p1,
+                             const vdouble2 &p2,
+                             const vdouble2 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmadd_pd(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fnma(const vfloat4 &p1,
+                            const vfloat4 &p2,
+                            const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmadd_ps(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fnma(const vdouble4 &p1,
+                             const vdouble4 &p2,
+                             const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmadd_pd(p1, p2, p3);
+#else
+    return p3 - p1 * p2;
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fnma(const vfloat8 &p1,
+                            const vfloat8 &p2,
+                            const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmadd_ps(p1, p2, p3);
+#elif defined(__AVX__)
+    return p3 - p1 * p2;
+#else
+    return vfloat8(fnma(vfloat4(p1.vl), vfloat4(p2.vl), vfloat4(p3.vl)),
+                   fnma(vfloat4(p1.vh), vfloat4(p2.vh), vfloat4(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fnma(const vdouble8 &p1,
+                             const vdouble8 &p2,
+                             const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmadd_pd(p1, p2, p3);
+#else
+    return vdouble8(fnma(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fnma(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fnma(const vfloat16 &p1,
+                             const vfloat16 &p2,
+                             const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmadd_ps(p1, p2, p3);
+#else
+    return vfloat16(fnma(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fnma(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fnma(const vdouble16 &p1,
+                              const vdouble16 &p2,
+                              const vdouble16 &p3)
+  {
+    return vdouble16(fnma(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fnma(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> fnma(
+      const pack<T, W> &p1, const pack<T, W> &p2, const pack<T, W> &p3)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(fnma(half_t(p1.vl), half_t(p2.vl), half_t(p3.vl)),
+                      fnma(half_t(p1.vh), half_t(p2.vh), half_t(p3.vh)));
+  }
+
+  // Inferred pack<>/scalar versions //
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::valid_pack_scalar_operator_t<T, OTHER_T>>
+  TSIMD_INLINE pack<T, W> fnma(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const OTHER_T &v)
+  {
+    return fnma(p1, p2, pack<T, W>(v));
+  }
+
+  // fnms() ///////////////////////////////////////////////////////////////////
+
+  // 1-wide //
+
+  template <typename T, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, 1> fnms(const pack<T, 1> &p1,
+                               const pack<T, 1> &p2,
+                               const pack<T, 1> &p3)
+  {
+#if defined(__FMA__)
+    return pack<T, 1>(-std::fma(p1[0], p2[0], p3[0]));
+#else
+    return pack<T, 1>(-(p1[0] * p2[0] + p3[0]));
+#endif
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 fnms(const vdouble2 &p1,
+                             const vdouble2 &p2,
+                             const vdouble2 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmsub_pd(p1, p2, p3);
+#else
+    return vdouble2(-0.0) - (p1 * p2 + p3);
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 fnms(const vfloat4 &p1,
+                            const vfloat4 &p2,
+                            const vfloat4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm_fnmsub_ps(p1, p2, p3);
+#else
+    return vfloat4(-0.f) - (p1 * p2 + p3);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fnms(const vdouble4 &p1,
+                             const vdouble4 &p2,
+                             const vdouble4 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmsub_pd(p1, p2, p3);
+#else
+    return vdouble4(-0.0) - (p1 * p2 + p3);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 fnms(const vfloat8 &p1,
+                            const vfloat8 &p2,
+                            const vfloat8 &p3)
+  {
+#if defined(__FMA__)
+    return _mm256_fnmsub_ps(p1, p2, p3);
+#elif defined(__AVX__)
+    return vfloat8(-0.f) - (p1 * p2 + p3);
+#else
+    return vfloat8(fnms(vfloat4(p1.vl), vfloat4(p2.vl), vfloat4(p3.vl)),
+                   fnms(vfloat4(p1.vh), vfloat4(p2.vh), vfloat4(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 fnms(const vdouble8 &p1,
+                             const vdouble8 &p2,
+                             const vdouble8 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmsub_pd(p1, p2, p3);
+#else
+    return vdouble8(fnms(vdouble4(p1.vl), vdouble4(p2.vl), vdouble4(p3.vl)),
+                    fnms(vdouble4(p1.vh), vdouble4(p2.vh), vdouble4(p3.vh)));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 fnms(const vfloat16 &p1,
+                             const vfloat16 &p2,
+                             const vfloat16 &p3)
+  {
+#if defined(__AVX512F__)
+    return _mm512_fnmsub_ps(p1, p2, p3);
+#else
+    return vfloat16(fnms(vfloat8(p1.vl), vfloat8(p2.vl), vfloat8(p3.vl)),
+                    fnms(vfloat8(p1.vh), vfloat8(p2.vh), vfloat8(p3.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vdouble16 fnms(const vdouble16 &p1,
+                              const vdouble16 &p2,
+                              const vdouble16 &p3)
+  {
+    return vdouble16(fnms(vdouble8(p1.vl), vdouble8(p2.vl), vdouble8(p3.vl)),
+                     fnms(vdouble8(p1.vh), vdouble8(p2.vh), vdouble8(p3.vh)));
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> fnms(
+      const pack<T, W> &p1, const pack<T, W> &p2, const pack<T, W> &p3)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(fnms(half_t(p1.vl), half_t(p2.vl), half_t(p3.vl)),
+                      fnms(half_t(p1.vh), half_t(p2.vh), half_t(p3.vh)));
+  }
+
+  // Inferred pack<>/scalar versions //
+
+  template <typename T,
+            int W,
+            typename OTHER_T,
+            typename = traits::valid_pack_scalar_operator_t<T, OTHER_T>>
+  TSIMD_INLINE pack<T, W> fnms(const pack<T, W> &p1,
+                               const pack<T, W> &p2,
+                               const OTHER_T &v)
+  {
+    return fnms(p1, p2, pack<T, W>(v));
+  }
+
+}  // namespace tsimd
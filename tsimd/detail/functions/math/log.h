@@ -25,11 +25,17 @@
 #pragma once
 
 #include <cmath>
+#include <limits>
 
 #include "../../pack.h"
 
+#include "../../operators/bitwise/right_shift.h"
+
 #include "../algorithm/select.h"
 
+#include "fma.h"
+#include "polynomial.h"
+
 namespace tsimd {
 
   template <typename T, int W>
@@ -69,7 +75,7 @@ namespace tsimd {
       // anyway (log(x), x = +-0 -> infinity, x < 0 -> NaN).
 
       //This number is [0, 255] but it means [-127, 128]
-      auto biased_exponent = int_version >> 23;
+      auto biased_exponent = shift_right_logical<23>(int_version);
 
       // Treat the number as if it were 2^{e+1} * (1.m)/2
       auto offset_exponent = biased_exponent + 1;
@@ -83,85 +89,147 @@ namespace tsimd {
 
   } // namespace detail
 
-#if 0 //TODO: convert this ispc version to tsimd
+  // fast_log() ///////////////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_log(const pack<T, W> &p)
+  {
+    return log(p);
+  }
+
+  // NOTE(jda) - port of ispc's fast_log(), max error is 1 ULP but there is no
+  //             handling of zero, negative, infinite, NaN or denormal inputs.
   template <int W>
   TSIMD_INLINE vfloatn<W> fast_log(const vfloatn<W> &p)
   {
-    int e;
-    p = frexp(p, &e);
-
-    int x_smaller_SQRTHF = (0.707106781186547524f > p) ? 0xffffffff : 0;
-    e += x_smaller_SQRTHF;
-    int ix_add = intbits(p);
-    ix_add &= x_smaller_SQRTHF;
-    p += floatbits(ix_add) - 1.f;
-
-    float z = p * p;
-    float y =
-        ((((((((7.0376836292E-2f * p
-                + -1.1514610310E-1f) * p
-               + 1.1676998740E-1f) * p
-              + -1.2420140846E-1f) * p
-             + 1.4249322787E-1f) * p
-            + -1.6668057665E-1f) * p
-           + 2.0000714765E-1f) * p
-          + -2.4999993993E-1f) * p
-         + 3.3333331174E-1f) * p * z;
-
-    float fe = (float)e;
-    y += fe * -2.12194440e-4;
+    vfloatn<W> x;
+    vintn<W> e;
+    detail::range_reduce_log(p, x, e);
+
+    auto fe = vfloatn<W>(e);
+
+    const auto x_smaller_SQRTHF = x < 0.707106781186547524f;
+    fe = select(x_smaller_SQRTHF, fe - 1.f, fe);
+    x  = select(x_smaller_SQRTHF, x + x, x) - 1.f;
+
+    auto z = x * x;
+    auto y = horner(x,
+                    3.3333331174E-1f,
+                    -2.4999993993E-1f,
+                    2.0000714765E-1f,
+                    -1.6668057665E-1f,
+                    1.4249322787E-1f,
+                    -1.2420140846E-1f,
+                    1.1676998740E-1f,
+                    -1.1514610310E-1f,
+                    7.0376836292E-2f) * x * z;
+
+    y += fe * -2.12194440e-4f;
     y -= 0.5f * z;
-    z  = p + y;
-    return z + 0.693359375 * fe;
+    z = x + y;
+    return z + 0.693359375f * fe;
   }
-#endif
 
+  // log() ////////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - max error is 1 ULP, returns NaN for negative inputs and -inf
+  //             for zero
   template <int W>
   TSIMD_INLINE vfloatn<W> log(const vfloatn<W> &p)
   {
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST
+    return fast_log(p);
+#else
     const vintn<W> NaN_bits(0x7fc00000);
     const vintn<W> Neg_Inf_bits(0xFF800000);
+    const vintn<W> Inf_bits(0x7F800000);
     const auto NaN = reinterpret_elements_as<float>(NaN_bits);
     const auto neg_inf = reinterpret_elements_as<float>(Neg_Inf_bits);
-    auto use_nan = p < 0;
-    auto use_inf = p == 0;
-    auto exceptional = use_nan | use_inf;
-    const vfloatn<W> one(1.0f);
-
-    auto patched = select(exceptional, one, p);
-
-    vfloatn<W> reduced;
-    vintn<W> exponent;
-    detail::range_reduce_log(patched, reduced, exponent);
-
-    const auto ln2 = 0.693147182464599609375f;
-
-    auto x1 = one - reduced;
-    const auto c1 = 0.50000095367431640625f;
-    const auto c2 = 0.33326041698455810546875f;
-    const auto c3 = 0.2519190013408660888671875f;
-    const auto c4 = 0.17541764676570892333984375f;
-    const auto c5 = 0.3424419462680816650390625f;
-    const auto c6 = -0.599632322788238525390625f;
-    const auto c7 = +1.98442304134368896484375f;
-    const auto c8 = -2.4899270534515380859375f;
-    const auto c9 = +1.7491014003753662109375f;
-
-    auto result = x1 * c9 + c8;
-    result = x1 * result + c7;
-    result = x1 * result + c6;
-    result = x1 * result + c5;
-    result = x1 * result + c4;
-    result = x1 * result + c3;
-    result = x1 * result + c2;
-    result = x1 * result + c1;
-    result = x1 * result + one;
-
-    // Equation was for -(ln(red)/(1-red))
-    result *= -x1;
-    result += vfloatn<W>(exponent) * ln2;
-
-    return select(exceptional, select(use_nan, NaN, neg_inf), result);
+    const auto inf = reinterpret_elements_as<float>(Inf_bits);
+    auto use_nan = !(p >= 0.f);
+    auto use_neg_inf = p == 0.f;
+    auto use_inf = p == inf;
+    auto exceptional = use_nan | use_neg_inf | use_inf;
+
+    // scale denormals by 2^24 so range_reduce_log() sees a normal exponent
+    const auto denormal = p < std::numeric_limits<float>::min();
+
+    auto patched = select(exceptional, vfloatn<W>(1.f), p);
+    patched = select(denormal, patched * 16777216.f, patched);
+
+    auto result = fast_log(patched);
+    result = select(denormal, result - 16.6355323f, result);
+
+    return select(exceptional,
+                  select(use_nan, NaN, select(use_inf, inf, neg_inf)),
+                  result);
+#endif
+  }
+
+  // Double precision version of log() from Cephes: write x = 2^e * m with m
+  // in [sqrt(1/2), sqrt(2)) and evaluate log(m) with a (5,5) rational
+  // approximation in m - 1. Max error is ~1 ULP.
+  template <int W>
+  TSIMD_INLINE vdoublen<W> log(const vdoublen<W> &p)
+  {
+    const vdoublen<W> inf(std::numeric_limits<double>::infinity());
+
+    const auto use_nan = !(p >= 0.);
+    const auto use_neg_inf = p == 0.;
+    const auto use_inf = p == inf;
+    const auto exceptional = use_nan | use_neg_inf | use_inf;
+
+    // scale denormals into the normal range before pulling the exponent apart
+    const auto denormal = p < std::numeric_limits<double>::min();
+
+    auto x = select(exceptional, vdoublen<W>(1.), p);
+    x = select(denormal, x * 18014398509481984.0, x);
+
+    // exponent field is moved into the mantissa of 2^52 to convert it to a
+    // double without an int->double conversion
+    const auto bits = reinterpret_elements_as<long long>(x);
+    auto e = reinterpret_elements_as<double>(shift_right_logical<52>(bits) |
+                                             0x4330000000000000LL);
+    e -= 4503599627370496.0 + 1022.0;
+    e = select(denormal, e - 54., e);
+
+    auto m = reinterpret_elements_as<double>(
+        (bits & 0x000FFFFFFFFFFFFFLL) | 0x3FE0000000000000LL);
+
+    const auto small = m < 0.70710678118654752440;
+    e = select(small, e - 1., e);
+    m = select(small, m + m, m) - 1.;
+
+    const auto px = horner(m,
+                           7.70838733755885391666e0,
+                           1.79368678507819816313e1,
+                           1.44989225341610930846e1,
+                           4.70579119878881725854e0,
+                           4.97494994976747001425e-1,
+                           1.01875663804580931796e-4);
+
+    const auto qx = horner(m,
+                           2.31251620126765340583e1,
+                           7.11544750618563894466e1,
+                           8.29875266912776603211e1,
+                           4.52279145837532221105e1,
+                           1.12873587189167450590e1,
+                           1.0);
+
+    const auto z = m * m;
+
+    // ln(2) split in two so that e * 0.693359375 is exact
+    auto y = m * (z * px / qx);
+    y -= e * 2.121944400546905827679e-4;
+    y -= 0.5 * z;
+
+    auto result = m + y;
+    result += e * 0.693359375;
+
+    const vdoublen<W> NaN(std::numeric_limits<double>::quiet_NaN());
+    return select(exceptional,
+                  select(use_nan, NaN, select(use_inf, inf, -inf)),
+                  result);
   }
 
 }  // namespace tsimd
@@ -38,6 +38,22 @@ namespace tsimd {
     return pack<T, 1>(std::min(p1[0], p2[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 min(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_min_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 min(const vfloat4 &p1, const vfloat4 &p2)
@@ -68,6 +84,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 min(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_min_epu32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vdouble4 min(const vdouble4 &p1, const vdouble4 &p2)
   {
 #if defined(__AVX__)
@@ -84,12 +114,22 @@ namespace tsimd {
 
   TSIMD_INLINE vllong4 min(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512VL__)
+    return _mm256_min_epi64(p1, p2);
+#elif defined(__AVX2__)
+    return _mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(p2),
+                         _mm256_castsi256_pd(p1),
+                         _mm256_castsi256_pd(_mm256_cmpgt_epi64(p2, p1))));
+#else
+    TSIMD_SCALAR_FALLBACK("vllong4 min()");
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = std::min(p1[i], p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -116,6 +156,18 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 min(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu32(p1, p2);
+#elif defined(__AVX__)
+    return vuint8(_mm_min_epu32(p1.vl, p2.vl), _mm_min_epu32(p1.vh, p2.vh));
+#else
+    return vuint8(min(vuint4(p1.vl), vuint4(p2.vl)),
+                  min(vuint4(p1.vh), vuint4(p2.vh)));
+#endif
+  }
+
   TSIMD_INLINE vdouble8 min(const vdouble8 &p1, const vdouble8 &p2)
   {
 #if defined(__AVX512F__)
@@ -158,6 +210,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 min(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_min_epu32(p1, p2);
+#else
+    return vuint16(min(vuint8(p1.vl), vuint8(p2.vl)),
+                   min(vuint8(p1.vh), vuint8(p2.vh)));
+#endif
+  }
+
   TSIMD_INLINE vdouble16 min(const vdouble16 &p1, const vdouble16 &p2)
   {
     return vdouble16(min(vdouble8(p1.vl), vdouble8(p2.vl)),
@@ -170,4 +232,130 @@ namespace tsimd {
                     min(vllong8(p1.vh), vllong8(p2.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> min(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(min(half_t(p1.vl), half_t(p2.vl)),
+                      min(half_t(p1.vh), half_t(p2.vh)));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> min(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = std::min(p1[i], p2[i]);
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 min(const vchar16 &p1, const vchar16 &p2)
+  {
+    return _mm_min_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vuchar16 min(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_min_epu8(p1, p2);
+  }
+
+  TSIMD_INLINE vshort8 min(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_min_epi16(p1, p2);
+  }
+
+  TSIMD_INLINE vushort8 min(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_min_epu16(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 min(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi8(p1, p2);
+#else
+    return vchar32(min(vchar16(p1.vl), vchar16(p2.vl)),
+                   min(vchar16(p1.vh), vchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 min(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu8(p1, p2);
+#else
+    return vuchar32(min(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    min(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 min(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epi16(p1, p2);
+#else
+    return vshort16(min(vshort8(p1.vl), vshort8(p2.vl)),
+                    min(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 min(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_min_epu16(p1, p2);
+#else
+    return vushort16(min(vushort8(p1.vl), vushort8(p2.vl)),
+                     min(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 min(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi8(p1, p2);
+#else
+    return vchar64(min(vchar32(p1.vl), vchar32(p2.vl)),
+                   min(vchar32(p1.vh), vchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 min(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu8(p1, p2);
+#else
+    return vuchar64(min(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    min(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 min(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epi16(p1, p2);
+#else
+    return vshort32(min(vshort16(p1.vl), vshort16(p2.vl)),
+                    min(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 min(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_min_epu16(p1, p2);
+#else
+    return vushort32(min(vushort16(p1.vl), vushort16(p2.vl)),
+                     min(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
 }  // namespace tsimd
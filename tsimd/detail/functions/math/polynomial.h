@@ -0,0 +1,94 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <array>
+
+#include "../../pack.h"
+#include "../../operators/arithmetic/times.h"
+
+#include "fma.h"
+
+namespace tsimd {
+
+  // NOTE(jda) - Both evaluate c0 + c1*x + c2*x^2 + ... + cn*x^n, with the
+  //             coefficients given lowest order first. The number of
+  //             coefficients is fixed at compile time, so the loops below are
+  //             fully unrolled and the coefficients become broadcast
+  //             constants.
+  //
+  //             horner() is a chain of n dependent fma()s: the fewest
+  //             operations, but latency bound. estrin() evaluates pairs of
+  //             terms in parallel on x, x^2, x^4, ..., which shortens the
+  //             dependency chain to ~log2(n) fma()s at the cost of computing
+  //             the powers of x. It also rounds differently from horner().
+
+  // horner() /////////////////////////////////////////////////////////////////
+
+  template <typename T, int W, typename... COEFFS>
+  TSIMD_INLINE pack<T, W> horner(const pack<T, W> &x, const COEFFS &... c)
+  {
+    static_assert(sizeof...(COEFFS) > 0,
+                  "tsimd::horner() requires at least one coefficient!");
+
+    constexpr int N = sizeof...(COEFFS);
+    const std::array<T, N> coeffs = {{static_cast<T>(c)...}};
+
+    pack<T, W> result(coeffs[N - 1]);
+
+    for (int i = N - 2; i >= 0; --i)
+      result = fma(result, x, pack<T, W>(coeffs[i]));
+
+    return result;
+  }
+
+  // estrin() /////////////////////////////////////////////////////////////////
+
+  template <typename T, int W, typename... COEFFS>
+  TSIMD_INLINE pack<T, W> estrin(const pack<T, W> &x, const COEFFS &... c)
+  {
+    static_assert(sizeof...(COEFFS) > 0,
+                  "tsimd::estrin() requires at least one coefficient!");
+
+    constexpr int N = sizeof...(COEFFS);
+    std::array<pack<T, W>, N> terms = {{pack<T, W>(static_cast<T>(c))...}};
+
+    auto xn = x;
+
+    for (int n = N; n > 1; n = (n + 1) / 2) {
+      for (int i = 0; i < n / 2; ++i)
+        terms[i] = fma(terms[2 * i + 1], xn, terms[2 * i]);
+
+      if (n % 2)
+        terms[n / 2] = terms[n - 1];
+
+      if (n > 2)
+        xn = xn * xn;
+    }
+
+    return terms[0];
+  }
+
+}  // namespace tsimd
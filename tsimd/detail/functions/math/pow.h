@@ -37,4 +37,19 @@ namespace tsimd {
     return exp(b * log(v));
   }
 
+  template <typename T, int W, typename = traits::is_floating_point_t<T>>
+  TSIMD_INLINE pack<T, W> fast_pow(const pack<T, W> &v, const float b)
+  {
+    return fast_exp(b * fast_log(v));
+  }
+
+  // NOTE(jda) - exp() and log() are each ~1 ULP, but the error of log(v) is
+  //             scaled by 'b' before going through exp(), so the relative
+  //             error of the result grows with |b * log(v)|.
+  template <int W>
+  TSIMD_INLINE vdoublen<W> pow(const vdoublen<W> &v, const double b)
+  {
+    return exp(b * log(v));
+  }
+
 }  // namespace tsimd
\ No newline at end of file
@@ -28,8 +28,87 @@
 
 #include "../../pack.h"
 
+#include "../../operators/arithmetic/divide.h"
+
 namespace tsimd {
 
+  // exact_rcp() //////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - correctly rounded, including zero/infinite/NaN inputs
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> exact_rcp(const pack<T, W> &p)
+  {
+    return pack<T, W>(T(1)) / p;
+  }
+
+  // fast_rcp() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - hardware estimates where available: 12 bits (SSE/AVX) or 14
+  //             bits (AVX512), otherwise falls back to rcp(). rcp() refines
+  //             the estimate with one Newton-Raphson step (~23 bits) unless
+  //             TSIMD_MATH_PRECISION is TSIMD_MATH_FAST. Neither handles zero
+  //             or infinite inputs, use exact_rcp() when those can occur.
+  //
+  //             Double packs refine the estimate once in double precision:
+  //             ~23 bits from the float estimate (inputs must lie within
+  //             float range), ~28 bits from the AVX512 one.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_rcp(const pack<T, W> &p)
+  {
+    return rcp(p);
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vfloat4 fast_rcp(const vfloat4 &p)
+  {
+    return _mm_rcp_ps(p);
+  }
+#endif
+
+#if defined(__AVX__)
+  TSIMD_INLINE vfloat8 fast_rcp(const vfloat8 &p)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_rcp14_ps(p);
+#else
+    return _mm256_rcp_ps(p);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fast_rcp(const vdouble4 &p)
+  {
+#if defined(__AVX512VL__)
+    const __m256d r = _mm256_rcp14_pd(p);
+#else
+    const __m256d r = _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(p)));
+#endif
+
+#if defined(__FMA__)
+    return _mm256_mul_pd(r, _mm256_fnmadd_pd(r, p, _mm256_set1_pd(2.0)));
+#else
+    return _mm256_mul_pd(
+        r, _mm256_sub_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(r, p)));
+#endif
+  }
+#endif
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE vfloat16 fast_rcp(const vfloat16 &p)
+  {
+    return _mm512_rcp14_ps(p);
+  }
+
+  TSIMD_INLINE vdouble8 fast_rcp(const vdouble8 &p)
+  {
+    const __m512d r = _mm512_rcp14_pd(p);
+    return _mm512_mul_pd(r, _mm512_fnmadd_pd(r, p, _mm512_set1_pd(2.0)));
+  }
+#endif
+
+  // rcp() ////////////////////////////////////////////////////////////////////
+
   // 1-wide //
 
   template <typename T>
@@ -43,7 +122,15 @@ namespace tsimd {
   TSIMD_INLINE vfloat4 rcp(const vfloat4 &p)
   {
 #if defined(__SSE4_2__)
-    return _mm_rcp_ps(p);
+    const vfloat4 r = fast_rcp(p);
+#endif
+
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__SSE4_2__)
+    return r;
+#elif defined(__FMA__)
+    return _mm_mul_ps(r, _mm_fnmadd_ps(r, p, vfloat4(2.0f)));
+#elif defined(__SSE4_2__)
+    return _mm_mul_ps(r, _mm_sub_ps(vfloat4(2.0f), _mm_mul_ps(r, p)));
 #else
     vfloat4 result;
 
@@ -56,25 +143,32 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 rcp(const vdouble4 &p)
   {
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX__)
+    return fast_rcp(p);
+#elif defined(__AVX__)
+    return _mm256_div_pd(_mm256_set1_pd(1.0), p);
+#else
+    TSIMD_SCALAR_FALLBACK("rcp(vdouble4)");
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = 1. / p[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
 
   TSIMD_INLINE vfloat8 rcp(const vfloat8 &p)
   {
-#if defined(__AVX512VL__)
-    const vfloat8 r = _mm256_rcp14_ps(p);
-#elif defined(__AVX__)
-    const vfloat8 r = _mm256_rcp_ps(p);
+#if defined(__AVX__)
+    const vfloat8 r = fast_rcp(p);
 #endif
 
-#if defined(__AVX2__)
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX__)
+    return r;
+#elif defined(__FMA__)
     return _mm256_mul_ps(r, _mm256_fnmadd_ps(r, p, vfloat8(2.0f)));
 #elif defined(__AVX__)
     return _mm256_mul_ps(r, _mm256_sub_ps(vfloat8(2.0f), _mm256_mul_ps(r, p)));
@@ -85,8 +179,10 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 rcp(const vdouble8 &p)
   {
-#if defined(__AVX512F__)
-    return _mm512_rcp14_pd(p);
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX512F__)
+    return fast_rcp(p);
+#elif defined(__AVX512F__)
+    return _mm512_div_pd(_mm512_set1_pd(1.0), p);
 #else
     return vdouble8(rcp(vdouble4(p.vl)), rcp(vdouble4(p.vh)));
 #endif
@@ -97,7 +193,13 @@ namespace tsimd {
   TSIMD_INLINE vfloat16 rcp(const vfloat16 &p)
   {
 #if defined(__AVX512F__)
-    return _mm512_rcp14_ps(p);
+    const vfloat16 r = fast_rcp(p);
+#endif
+
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX512F__)
+    return r;
+#elif defined(__AVX512F__)
+    return _mm512_mul_ps(r, _mm512_fnmadd_ps(r, p, vfloat16(2.0f)));
 #else
     return vfloat16(rcp(vfloat8(p.vl)), rcp(vfloat8(p.vh)));
 #endif
@@ -108,4 +210,14 @@ namespace tsimd {
     return vdouble16(rcp(vdouble8(p.vl)), rcp(vdouble8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> rcp(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(rcp(half_t(p.vl)), rcp(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
@@ -28,10 +28,91 @@
 
 #include "../../pack.h"
 
+#include "../../operators/arithmetic/divide.h"
 #include "sqrt.h"
 
 namespace tsimd {
 
+  // exact_rsqrt() ////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - full precision sqrt() followed by a division
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> exact_rsqrt(const pack<T, W> &p)
+  {
+    return pack<T, W>(T(1)) / sqrt(p);
+  }
+
+  // fast_rsqrt() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - hardware estimates where available: 12 bits (SSE/AVX) or 14
+  //             bits (AVX512), otherwise falls back to rsqrt(). rsqrt()
+  //             refines the estimate with one Newton-Raphson step (~23 bits)
+  //             unless TSIMD_MATH_PRECISION is TSIMD_MATH_FAST. Neither
+  //             handles zero or infinite inputs, use exact_rsqrt() for those.
+  //
+  //             Double packs refine the estimate once in double precision:
+  //             ~23 bits from the float estimate (inputs must lie within
+  //             float range), ~28 bits from the AVX512 one.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_rsqrt(const pack<T, W> &p)
+  {
+    return rsqrt(p);
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vfloat4 fast_rsqrt(const vfloat4 &p)
+  {
+    return _mm_rsqrt_ps(p);
+  }
+#endif
+
+#if defined(__AVX__)
+  TSIMD_INLINE vfloat8 fast_rsqrt(const vfloat8 &p)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_rsqrt14_ps(p);
+#else
+    return _mm256_rsqrt_ps(p);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 fast_rsqrt(const vdouble4 &p)
+  {
+#if defined(__AVX512VL__)
+    const __m256d r = _mm256_rsqrt14_pd(p);
+#else
+    const __m256d r = _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(p)));
+#endif
+
+    const __m256d pr = _mm256_mul_pd(p, r);
+#if defined(__FMA__)
+    const __m256d e = _mm256_fnmadd_pd(pr, r, _mm256_set1_pd(3.0));
+#else
+    const __m256d e = _mm256_sub_pd(_mm256_set1_pd(3.0), _mm256_mul_pd(pr, r));
+#endif
+    return _mm256_mul_pd(_mm256_mul_pd(_mm256_set1_pd(0.5), r), e);
+  }
+#endif
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE vfloat16 fast_rsqrt(const vfloat16 &p)
+  {
+    return _mm512_rsqrt14_ps(p);
+  }
+
+  TSIMD_INLINE vdouble8 fast_rsqrt(const vdouble8 &p)
+  {
+    const __m512d r  = _mm512_rsqrt14_pd(p);
+    const __m512d pr = _mm512_mul_pd(p, r);
+    const __m512d e  = _mm512_fnmadd_pd(pr, r, _mm512_set1_pd(3.0));
+    return _mm512_mul_pd(_mm512_mul_pd(_mm512_set1_pd(0.5), r), e);
+  }
+#endif
+
+  // rsqrt() //////////////////////////////////////////////////////////////////
+
   // 1-wide //
 
   template <typename T>
@@ -45,7 +126,19 @@ namespace tsimd {
   TSIMD_INLINE vfloat4 rsqrt(const vfloat4 &p)
   {
 #if defined(__SSE4_2__)
-    return _mm_rsqrt_ps(p);
+    const vfloat4 r = fast_rsqrt(p);
+#endif
+
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__SSE4_2__)
+    return r;
+#elif defined(__SSE4_2__)
+    const __m128 pr = _mm_mul_ps(p, r);
+#if defined(__FMA__)
+    const __m128 e = _mm_fnmadd_ps(pr, r, vfloat4(3.0f));
+#else
+    const __m128 e = _mm_sub_ps(vfloat4(3.0f), _mm_mul_ps(pr, r));
+#endif
+    return _mm_mul_ps(_mm_mul_ps(vfloat4(0.5f), r), e);
 #else
     vfloat4 result;
 
@@ -58,12 +151,19 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble4 rsqrt(const vdouble4 &p)
   {
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX__)
+    return fast_rsqrt(p);
+#elif defined(__AVX__)
+    return _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(p));
+#else
+    TSIMD_SCALAR_FALLBACK("rsqrt(vdouble4)");
     vdouble4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = 1. / std::sqrt(p[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -71,7 +171,19 @@ namespace tsimd {
   TSIMD_INLINE vfloat8 rsqrt(const vfloat8 &p)
   {
 #if defined(__AVX__)
-    return _mm256_rsqrt_ps(p);
+    const vfloat8 r = fast_rsqrt(p);
+#endif
+
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX__)
+    return r;
+#elif defined(__AVX__)
+    const __m256 pr = _mm256_mul_ps(p, r);
+#if defined(__FMA__)
+    const __m256 e = _mm256_fnmadd_ps(pr, r, vfloat8(3.0f));
+#else
+    const __m256 e = _mm256_sub_ps(vfloat8(3.0f), _mm256_mul_ps(pr, r));
+#endif
+    return _mm256_mul_ps(_mm256_mul_ps(vfloat8(0.5f), r), e);
 #else
     return vfloat8(rsqrt(vfloat4(p.vl)), rsqrt(vfloat4(p.vh)));
 #endif
@@ -79,8 +191,10 @@ namespace tsimd {
 
   TSIMD_INLINE vdouble8 rsqrt(const vdouble8 &p)
   {
-#if defined(__AVX512F__)
-    return _mm512_rsqrt14_pd(p);
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX512F__)
+    return fast_rsqrt(p);
+#elif defined(__AVX512F__)
+    return _mm512_div_pd(_mm512_set1_pd(1.0), _mm512_sqrt_pd(p));
 #else
     return vdouble8(rsqrt(vdouble4(p.vl)), rsqrt(vdouble4(p.vh)));
 #endif
@@ -91,7 +205,15 @@ namespace tsimd {
   TSIMD_INLINE vfloat16 rsqrt(const vfloat16 &p)
   {
 #if defined(__AVX512F__)
-    return _mm512_rsqrt14_ps(p);
+    const vfloat16 r = fast_rsqrt(p);
+#endif
+
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST && defined(__AVX512F__)
+    return r;
+#elif defined(__AVX512F__)
+    const __m512 pr = _mm512_mul_ps(p, r);
+    const __m512 e  = _mm512_fnmadd_ps(pr, r, vfloat16(3.0f));
+    return _mm512_mul_ps(_mm512_mul_ps(vfloat16(0.5f), r), e);
 #else
     return vfloat16(rsqrt(vfloat8(p.vl)), rsqrt(vfloat8(p.vh)));
 #endif
@@ -102,4 +224,14 @@ namespace tsimd {
     return vdouble16(rsqrt(vdouble8(p.vl)), rsqrt(vdouble8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> rsqrt(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(rsqrt(half_t(p.vl)), rsqrt(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
@@ -0,0 +1,159 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // saturating_add() /////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Adds 8-bit or 16-bit elements, clamping the result to the
+  //             range of the element type instead of wrapping around.
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> saturating_add(const pack<T, W> &p1,
+                                         const pack<T, W> &p2)
+  {
+    using limits = std::numeric_limits<T>;
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i) {
+      const int value = int(p1[i]) + int(p2[i]);
+      result[i] = static_cast<T>(std::min(
+          std::max(value, int(limits::min())), int(limits::max())));
+    }
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 saturating_add(const vchar16 &p1, const vchar16 &p2)
+  {
+    return _mm_adds_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vuchar16 saturating_add(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_adds_epu8(p1, p2);
+  }
+
+  TSIMD_INLINE vshort8 saturating_add(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_adds_epi16(p1, p2);
+  }
+
+  TSIMD_INLINE vushort8 saturating_add(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_adds_epu16(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 saturating_add(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epi8(p1, p2);
+#else
+    return vchar32(saturating_add(vchar16(p1.vl), vchar16(p2.vl)),
+                   saturating_add(vchar16(p1.vh), vchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 saturating_add(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epu8(p1, p2);
+#else
+    return vuchar32(saturating_add(vuchar16(p1.vl), vuchar16(p2.vl)),
+                    saturating_add(vuchar16(p1.vh), vuchar16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 saturating_add(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epi16(p1, p2);
+#else
+    return vshort16(saturating_add(vshort8(p1.vl), vshort8(p2.vl)),
+                    saturating_add(vshort8(p1.vh), vshort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 saturating_add(const vushort16 &p1,
+                                        const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_adds_epu16(p1, p2);
+#else
+    return vushort16(saturating_add(vushort8(p1.vl), vushort8(p2.vl)),
+                     saturating_add(vushort8(p1.vh), vushort8(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 saturating_add(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epi8(p1, p2);
+#else
+    return vchar64(saturating_add(vchar32(p1.vl), vchar32(p2.vl)),
+                   saturating_add(vchar32(p1.vh), vchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 saturating_add(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epu8(p1, p2);
+#else
+    return vuchar64(saturating_add(vuchar32(p1.vl), vuchar32(p2.vl)),
+                    saturating_add(vuchar32(p1.vh), vuchar32(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 saturating_add(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epi16(p1, p2);
+#else
+    return vshort32(saturating_add(vshort16(p1.vl), vshort16(p2.vl)),
+                    saturating_add(vshort16(p1.vh), vshort16(p2.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 saturating_add(const vushort32 &p1,
+                                        const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_adds_epu16(p1, p2);
+#else
+    return vushort32(saturating_add(vushort16(p1.vl), vushort16(p2.vl)),
+                     saturating_add(vushort16(p1.vh), vushort16(p2.vh)));
+#endif
+  }
+
+}  // namespace tsimd
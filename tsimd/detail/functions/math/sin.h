@@ -30,7 +30,10 @@
 
 #include "../algorithm/select.h"
 
+#include "abs.h"
 #include "floor.h"
+#include "fma.h"
+#include "polynomial.h"
 
 namespace tsimd {
 
@@ -45,56 +48,180 @@ namespace tsimd {
     return result;
   }
 
-  // Transcendental functions from "ispc": https://github.com/ispc/ispc/
-  // Most of the transcendental implementations in ispc code come from
-  // Solomon Boulos's "syrah": https://github.com/boulos/syrah/
+  namespace detail {
 
+    // Cody-Waite reduction of a non-negative argument by pi/4 (Cephes): 'y' is
+    // the even multiple of pi/4 nearest to x and the result x - y*pi/4 lies in
+    // [-pi/4, pi/4]. pi/4 is split in three parts, which keeps the reduction
+    // accurate for |x| up to ~8192 (float) or ~2^30 (double).
+    template <int W>
+    TSIMD_INLINE vfloatn<W> range_reduce_pio4(const vfloatn<W> &x,
+                                              vfloatn<W> &y)
+    {
+      y = floor(x * 1.27323954473516f);
+      y += y - 2.f * floor(y * 0.5f);
+
+      auto r = fnma(y, vfloatn<W>(0.78515625f), x);
+      r      = fnma(y, vfloatn<W>(2.4187564849853515625e-4f), r);
+      r      = fnma(y, vfloatn<W>(3.77489497744594108e-8f), r);
+      return r;
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> range_reduce_pio4(const vdoublen<W> &x,
+                                               vdoublen<W> &y)
+    {
+      y = floor(x * 1.27323954473516268615);
+      y += y - 2. * floor(y * 0.5);
+
+      auto r = fnma(y, vdoublen<W>(7.85398125648498535156e-1), x);
+      r      = fnma(y, vdoublen<W>(3.77489470793079817668e-8), r);
+      r      = fnma(y, vdoublen<W>(2.69515142907905952645e-15), r);
+      return r;
+    }
+
+    // sin(r) and cos(r) for |r| <= pi/4, with z = r*r, from Cephes
+    template <int W>
+    TSIMD_INLINE vfloatn<W> sin_pio4(const vfloatn<W> &r,
+                                     const vfloatn<W> &z)
+    {
+      const auto s =
+          horner(z, -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f);
+      return fma(r * z, s, r);
+    }
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> cos_pio4(const vfloatn<W> &z)
+    {
+      const auto c = horner(z,
+                            4.166664568298827e-2f,
+                            -1.388731625493765e-3f,
+                            2.443315711809948e-5f);
+      return fma(z * z, c, fnma(vfloatn<W>(0.5f), z, vfloatn<W>(1.f)));
+    }
+
+    // reduced precision (~14 bits) versions of the above
+    template <int W>
+    TSIMD_INLINE vfloatn<W> fast_sin_pio4(const vfloatn<W> &r,
+                                          const vfloatn<W> &z)
+    {
+      return fma(r * z, horner(z, -1.66657330e-1f, 8.21192031e-3f), r);
+    }
+
+    template <int W>
+    TSIMD_INLINE vfloatn<W> fast_cos_pio4(const vfloatn<W> &z)
+    {
+      return horner(z, 1.f, -4.99934843e-1f, 4.08187211e-2f);
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> sin_pio4(const vdoublen<W> &r,
+                                      const vdoublen<W> &z)
+    {
+      const auto s = horner(z,
+                            -1.66666666666666307295e-1,
+                            8.33333333332211858878e-3,
+                            -1.98412698295895385996e-4,
+                            2.75573136213857245213e-6,
+                            -2.50507477628578072866e-8,
+                            1.58962301576546568060e-10);
+      return fma(r * z, s, r);
+    }
+
+    template <int W>
+    TSIMD_INLINE vdoublen<W> cos_pio4(const vdoublen<W> &z)
+    {
+      const auto c = horner(z,
+                            4.16666666666665929218e-2,
+                            -1.38888888888730564116e-3,
+                            2.48015872888517045348e-5,
+                            -2.75573141792967388112e-7,
+                            2.08757008419747316778e-9,
+                            -1.13585365213876817300e-11);
+      return fma(z * z, c, fnma(vdoublen<W>(0.5), z, vdoublen<W>(1.)));
+    }
+
+  }  // namespace detail
+
+  // fast_sin() ///////////////////////////////////////////////////////////////
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> fast_sin(const pack<T, W> &p)
+  {
+    return sin(p);
+  }
+
+  // NOTE(jda) - reduced precision version, max absolute error is ~4e-5
+  template <int W>
+  TSIMD_INLINE vfloatn<W> fast_sin(const vfloatn<W> &p)
+  {
+    vfloatn<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8.f * floor(y * 0.125f);
+
+    const auto flipSign = j > 3.f;
+    j = select(flipSign, j - 4.f, j);
+
+    const auto useCos = (j == 1.f) | (j == 2.f);
+
+    auto result = select(
+        useCos, detail::fast_cos_pio4(z), detail::fast_sin_pio4(r, z));
+    result = select(flipSign, -result, result);
+    return select(p < 0.f, -result, result);
+  }
+
+  // sin() ////////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - max error is 2 ULP for |x| < pi, beyond that the absolute
+  //             error stays ~1e-7 up to |x| ~ 8192
   template <int W>
   TSIMD_INLINE vfloatn<W> sin(const vfloatn<W> &p)
   {
-    static const float piOverTwoVec = 1.57079637050628662109375;
-    static const float twoOverPiVec = 0.636619746685028076171875;
-    const auto scaled = p * twoOverPiVec;
-    const auto kReal = floor(scaled);
-    const auto k = vintn<W>(kReal);
-
-    // Reduced range version of x
-    const auto x = p - kReal * piOverTwoVec;
-    const auto kMod4 = k & 3;
-    const auto sinUseCos = ((kMod4 == 1) | (kMod4 == 3));
-    const auto flipSign = (kMod4 > 1);
-
-    // These coefficients are from sollya with fpminimax(sin(x)/x, [|0, 2,
-    // 4, 6, 8, 10|], [|single...|], [0;Pi/2]);
-    static const float sinC2 = -0.16666667163372039794921875;
-    static const float sinC4 = 8.333347737789154052734375e-3;
-    static const float sinC6 = -1.9842604524455964565277099609375e-4;
-    static const float sinC8 = 2.760012648650445044040679931640625e-6;
-    static const float sinC10 = -2.50293279435709337121807038784027099609375e-8;
-
-    static const float cosC2 = -0.5;
-    static const float cosC4 = 4.166664183139801025390625e-2;
-    static const float cosC6 = -1.388833043165504932403564453125e-3;
-    static const float cosC8 = 2.47562347794882953166961669921875e-5;
-    static const float cosC10 = -2.59630184018533327616751194000244140625e-7;
-
-    const auto outside = select(sinUseCos, 1.f, x);
-    const auto c2 = select(sinUseCos, vfloatn<W>(cosC2), vfloatn<W>(sinC2));
-    const auto c4 = select(sinUseCos, vfloatn<W>(cosC4), vfloatn<W>(sinC4));
-    const auto c6 = select(sinUseCos, vfloatn<W>(cosC6), vfloatn<W>(sinC6));
-    const auto c8 = select(sinUseCos, vfloatn<W>(cosC8), vfloatn<W>(sinC8));
-    const auto c10 = select(sinUseCos, vfloatn<W>(cosC10), vfloatn<W>(sinC10));
-
-    const auto x2 = x * x;
-    auto formula = x2 * c10 + c8;
-    formula = x2 * formula + c6;
-    formula = x2 * formula + c4;
-    formula = x2 * formula + c2;
-    formula = x2 * formula + 1.;
-    formula *= outside;
-
-    formula = select(flipSign, -formula, formula);
-    return formula;
+#if TSIMD_MATH_PRECISION == TSIMD_MATH_FAST
+    return fast_sin(p);
+#else
+    vfloatn<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8.f * floor(y * 0.125f);
+
+    const auto flipSign = j > 3.f;
+    j = select(flipSign, j - 4.f, j);
+
+    const auto useCos = (j == 1.f) | (j == 2.f);
+
+    auto result = select(
+        useCos, detail::cos_pio4(z), detail::sin_pio4(r, z));
+    result = select(flipSign, -result, result);
+    return select(p < 0.f, -result, result);
+#endif
+  }
+
+  // Double precision version of sin(), max error is ~1 ULP for |x| < 2^30
+  template <int W>
+  TSIMD_INLINE vdoublen<W> sin(const vdoublen<W> &p)
+  {
+    vdoublen<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    // octant in [0, 8)
+    auto j = y - 8. * floor(y * 0.125);
+
+    const auto flipSign = j > 3.;
+    j = select(flipSign, j - 4., j);
+
+    const auto useCos = (j == 1.) | (j == 2.);
+
+    auto result =
+        select(useCos, detail::cos_pio4(z), detail::sin_pio4(r, z));
+    result = select(flipSign, -result, result);
+    return select(p < 0., -result, result);
   }
 
 #if TSIMD_COMPILER_INTEL
@@ -38,6 +38,22 @@ namespace tsimd {
     return pack<T, 1>(std::sqrt(p[0]));
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 sqrt(const vdouble2 &p)
+  {
+#if defined(__SSE4_2__)
+    return _mm_sqrt_pd(p);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = std::sqrt(p[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 sqrt(const vfloat4 &p)
@@ -104,4 +120,14 @@ namespace tsimd {
     return vdouble16(sqrt(vdouble8(p.vl)), sqrt(vdouble8(p.vh)));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> sqrt(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(sqrt(half_t(p.vl)), sqrt(half_t(p.vh)));
+  }
+
 }  // namespace tsimd
@@ -32,6 +32,8 @@
 #include "../algorithm/set_if.h"
 
 #include "cos.h"
+#include "fma.h"
+#include "polynomial.h"
 #include "sin.h"
 
 namespace tsimd {
@@ -90,12 +92,8 @@ namespace tsimd {
 
     vfloatn<W> z;
     if (any(useCotan)) {
-      auto cotVal = x2 * cotC12 + cotC10;
-      cotVal = x2 * cotVal + cotC8;
-      cotVal = x2 * cotVal + cotC6;
-      cotVal = x2 * cotVal + cotC4;
-      cotVal = x2 * cotVal + cotC2;
-      cotVal = x2 * cotVal + oneVec;
+      auto cotVal = horner(
+          x2, oneVec, cotC2, cotC4, cotC6, cotC8, cotC10, cotC12);
       // The equation is for x * cot(x) but we need -x * cot(x) for the tan part
       cotVal /= -x;
       z = cotVal;
@@ -103,12 +101,8 @@ namespace tsimd {
 
     const auto useTan = vboolfn<W>(!useCotan);
     if (any(useTan)) {
-      auto tanVal = x2 * tanC12 + tanC10;
-      tanVal = x2 * tanVal + tanC8;
-      tanVal = x2 * tanVal + tanC6;
-      tanVal = x2 * tanVal + tanC4;
-      tanVal = x2 * tanVal + tanC2;
-      tanVal = x2 * tanVal + oneVec;
+      auto tanVal = horner(
+          x2, oneVec, tanC2, tanC4, tanC6, tanC8, tanC10, tanC12);
       // Equation was for tan(x)/x
       tanVal *= x;
       set_if(z, tanVal, useTan);
@@ -117,6 +111,36 @@ namespace tsimd {
     return select(xLt0, -z, z);
   }
 
+  // Double precision version of tan() from Cephes, using a (2,4) rational
+  // approximation on [-pi/4, pi/4] and tan(x) = -1/tan(x - pi/2) for the
+  // other half of the period. Max error is ~1 ULP for |x| < 2^30.
+  template <int W>
+  TSIMD_INLINE vdoublen<W> tan(const vdoublen<W> &p)
+  {
+    vdoublen<W> y;
+    const auto r = detail::range_reduce_pio4(abs(p), y);
+    const auto z = r * r;
+
+    const auto px = horner(z,
+                           -1.79565251976484877988e7,
+                           1.15351664838587416140e6,
+                           -1.30936939181383777646e4);
+
+    const auto qx = horner(z,
+                           -5.38695755929454629881e7,
+                           2.50083801823357915839e7,
+                           -1.32089234440210967447e6,
+                           1.36812963470692954678e4,
+                           1.0);
+
+    auto result = fma(r, z * px / qx, r);
+
+    const auto useCotan = (y - 4. * floor(y * 0.25)) == 2.;
+    result = select(useCotan, -1. / result, result);
+
+    return select(p < 0., -result, result);
+  }
+
 #if TSIMD_COMPILER_INTEL
 
 #if defined(__SSE4_2__)
@@ -26,6 +26,11 @@
 
 #include "memory/gather.h"
 #include "memory/load.h"
+#include "memory/load_unaligned.h"
+#include "memory/prefetch.h"
 #include "memory/scatter.h"
+#include "memory/scatter_add.h"
 #include "memory/store.h"
+#include "memory/store_stream.h"
+#include "memory/store_unaligned.h"
 #include "memory/reverse_bits.h"
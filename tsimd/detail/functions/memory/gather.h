@@ -25,20 +25,534 @@
 #pragma once
 
 #include "../../pack.h"
+#include "../../operators/arithmetic/times.h"
+#include "load.h"
 
 namespace tsimd {
 
-  template <typename PACK_T, typename OFFSET_T>
+  namespace detail {
+
+    // NOTE(jda) - Hardware gathers/scatters can only scale offsets by 1, 2, 4,
+    //             or 8 bytes, so any remaining factor of SCALE is applied to
+    //             the offsets before issuing the instruction.
+    template <int SCALE>
+    struct memory_scale
+    {
+      static_assert(SCALE > 0, "gather/scatter SCALE must be positive!");
+
+      enum
+      {
+        hw = (SCALE % 8 == 0) ? 8
+                              : (SCALE % 4 == 0) ? 4 : (SCALE % 2 == 0) ? 2 : 1,
+        factor = SCALE / hw
+      };
+    };
+
+    template <int SCALE, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<OFFSET_T, W> scale_offsets(const pack<OFFSET_T, W> &o)
+    {
+      return memory_scale<SCALE>::factor == 1
+                 ? o
+                 : o * OFFSET_T(memory_scale<SCALE>::factor);
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<T, W> gather_loop(const T *_src,
+                                        const pack<OFFSET_T, W> &o)
+    {
+      auto *src = (const char *)_src;
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i)
+        result[i] = *(const T *)(src + static_cast<long long>(o[i]) * SCALE);
+
+      return result;
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<T, W> gather_loop(const T *_src,
+                                        const pack<OFFSET_T, W> &o,
+                                        const mask<T, W> &m)
+    {
+      auto *src = (const char *)_src;
+      pack<T, W> result(T(0));
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          result[i] = *(const T *)(src + static_cast<long long>(o[i]) * SCALE);
+
+      return result;
+    }
+
+    // Native gathers /////////////////////////////////////////////////////////
+
+    // NOTE(jda) - These overloads only exist when the instruction does, all
+    //             other pack/offset combinations are handled by the generic
+    //             versions below (which split wide packs down to ones that
+    //             can be gathered natively, or fall back to a scalar loop).
+
+#if defined(__AVX2__)
+    // 32-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat4 gather_scaled(const float *src, const vint4 &o)
+    {
+      return _mm_i32gather_ps(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat4 gather_scaled(const float *src,
+                                       const vint4 &o,
+                                       const vboolf4 &m)
+    {
+      return _mm_mask_i32gather_ps(_mm_setzero_ps(),
+                                   src,
+                                   scale_offsets<SCALE>(o),
+                                   m,
+                                   memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint4 gather_scaled(const int *src, const vint4 &o)
+    {
+      return _mm_i32gather_epi32(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint4 gather_scaled(const int *src,
+                                     const vint4 &o,
+                                     const vboolf4 &m)
+    {
+      return _mm_mask_i32gather_epi32(_mm_setzero_si128(),
+                                      src,
+                                      scale_offsets<SCALE>(o),
+                                      _mm_castps_si128(m),
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble4 gather_scaled(const double *src, const vint4 &o)
+    {
+      return _mm256_i32gather_pd(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble4 gather_scaled(const double *src,
+                                        const vint4 &o,
+                                        const vboold4 &m)
+    {
+      return _mm256_mask_i32gather_pd(_mm256_setzero_pd(),
+                                      src,
+                                      scale_offsets<SCALE>(o),
+                                      m,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong4 gather_scaled(const long long *src, const vint4 &o)
+    {
+      return _mm256_i32gather_epi64(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong4 gather_scaled(const long long *src,
+                                       const vint4 &o,
+                                       const vboold4 &m)
+    {
+      return _mm256_mask_i32gather_epi64(_mm256_setzero_si256(),
+                                         src,
+                                         scale_offsets<SCALE>(o),
+                                         _mm256_castpd_si256(m),
+                                         memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat8 gather_scaled(const float *src, const vint8 &o)
+    {
+      return _mm256_i32gather_ps(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat8 gather_scaled(const float *src,
+                                       const vint8 &o,
+                                       const vboolf8 &m)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_mmask_i32gather_ps(_mm256_setzero_ps(),
+                                       m,
+                                       scale_offsets<SCALE>(o),
+                                       src,
+                                       memory_scale<SCALE>::hw);
+#else
+      return _mm256_mask_i32gather_ps(_mm256_setzero_ps(),
+                                      src,
+                                      scale_offsets<SCALE>(o),
+                                      m,
+                                      memory_scale<SCALE>::hw);
+#endif
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint8 gather_scaled(const int *src, const vint8 &o)
+    {
+      return _mm256_i32gather_epi32(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint8 gather_scaled(const int *src,
+                                     const vint8 &o,
+                                     const vboolf8 &m)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_mmask_i32gather_epi32(_mm256_setzero_si256(),
+                                          m,
+                                          scale_offsets<SCALE>(o),
+                                          src,
+                                          memory_scale<SCALE>::hw);
+#else
+      return _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                         src,
+                                         scale_offsets<SCALE>(o),
+                                         _mm256_castps_si256(m),
+                                         memory_scale<SCALE>::hw);
+#endif
+    }
+
+    // 64-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat4 gather_scaled(const float *src, const vllong4 &o)
+    {
+      return _mm256_i64gather_ps(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat4 gather_scaled(const float *src,
+                                       const vllong4 &o,
+                                       const vboolf4 &m)
+    {
+      return _mm256_mask_i64gather_ps(_mm_setzero_ps(),
+                                      src,
+                                      scale_offsets<SCALE>(o),
+                                      m,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint4 gather_scaled(const int *src, const vllong4 &o)
+    {
+      return _mm256_i64gather_epi32(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint4 gather_scaled(const int *src,
+                                     const vllong4 &o,
+                                     const vboolf4 &m)
+    {
+      return _mm256_mask_i64gather_epi32(_mm_setzero_si128(),
+                                         src,
+                                         scale_offsets<SCALE>(o),
+                                         _mm_castps_si128(m),
+                                         memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble4 gather_scaled(const double *src, const vllong4 &o)
+    {
+      return _mm256_i64gather_pd(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble4 gather_scaled(const double *src,
+                                        const vllong4 &o,
+                                        const vboold4 &m)
+    {
+      return _mm256_mask_i64gather_pd(_mm256_setzero_pd(),
+                                      src,
+                                      scale_offsets<SCALE>(o),
+                                      m,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong4 gather_scaled(const long long *src, const vllong4 &o)
+    {
+      return _mm256_i64gather_epi64(
+          src, scale_offsets<SCALE>(o), memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong4 gather_scaled(const long long *src,
+                                       const vllong4 &o,
+                                       const vboold4 &m)
+    {
+      return _mm256_mask_i64gather_epi64(_mm256_setzero_si256(),
+                                         src,
+                                         scale_offsets<SCALE>(o),
+                                         _mm256_castpd_si256(m),
+                                         memory_scale<SCALE>::hw);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    // 32-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble8 gather_scaled(const double *src, const vint8 &o)
+    {
+      return _mm512_i32gather_pd(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble8 gather_scaled(const double *src,
+                                        const vint8 &o,
+                                        const vboold8 &m)
+    {
+      return _mm512_mask_i32gather_pd(_mm512_setzero_pd(),
+                                      m,
+                                      scale_offsets<SCALE>(o),
+                                      src,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong8 gather_scaled(const long long *src, const vint8 &o)
+    {
+      return _mm512_i32gather_epi64(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong8 gather_scaled(const long long *src,
+                                       const vint8 &o,
+                                       const vboold8 &m)
+    {
+      return _mm512_mask_i32gather_epi64(_mm512_setzero_si512(),
+                                         m,
+                                         scale_offsets<SCALE>(o),
+                                         src,
+                                         memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat16 gather_scaled(const float *src, const vint16 &o)
+    {
+      return _mm512_i32gather_ps(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat16 gather_scaled(const float *src,
+                                        const vint16 &o,
+                                        const vboolf16 &m)
+    {
+      return _mm512_mask_i32gather_ps(_mm512_setzero_ps(),
+                                      m,
+                                      scale_offsets<SCALE>(o),
+                                      src,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint16 gather_scaled(const int *src, const vint16 &o)
+    {
+      return _mm512_i32gather_epi32(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint16 gather_scaled(const int *src,
+                                      const vint16 &o,
+                                      const vboolf16 &m)
+    {
+      return _mm512_mask_i32gather_epi32(_mm512_setzero_si512(),
+                                         m,
+                                         scale_offsets<SCALE>(o),
+                                         src,
+                                         memory_scale<SCALE>::hw);
+    }
+
+    // 64-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE vfloat8 gather_scaled(const float *src, const vllong8 &o)
+    {
+      return _mm512_i64gather_ps(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint8 gather_scaled(const int *src, const vllong8 &o)
+    {
+      return _mm512_i64gather_epi32(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+#if defined(__AVX512VL__)
+    template <int SCALE>
+    TSIMD_INLINE vfloat8 gather_scaled(const float *src,
+                                       const vllong8 &o,
+                                       const vboolf8 &m)
+    {
+      return _mm512_mask_i64gather_ps(_mm256_setzero_ps(),
+                                      m,
+                                      scale_offsets<SCALE>(o),
+                                      src,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vint8 gather_scaled(const int *src,
+                                     const vllong8 &o,
+                                     const vboolf8 &m)
+    {
+      return _mm512_mask_i64gather_epi32(_mm256_setzero_si256(),
+                                         m,
+                                         scale_offsets<SCALE>(o),
+                                         src,
+                                         memory_scale<SCALE>::hw);
+    }
+#endif
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble8 gather_scaled(const double *src, const vllong8 &o)
+    {
+      return _mm512_i64gather_pd(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vdouble8 gather_scaled(const double *src,
+                                        const vllong8 &o,
+                                        const vboold8 &m)
+    {
+      return _mm512_mask_i64gather_pd(_mm512_setzero_pd(),
+                                      m,
+                                      scale_offsets<SCALE>(o),
+                                      src,
+                                      memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong8 gather_scaled(const long long *src, const vllong8 &o)
+    {
+      return _mm512_i64gather_epi64(
+          scale_offsets<SCALE>(o), src, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE vllong8 gather_scaled(const long long *src,
+                                       const vllong8 &o,
+                                       const vboold8 &m)
+    {
+      return _mm512_mask_i64gather_epi64(_mm512_setzero_si512(),
+                                         m,
+                                         scale_offsets<SCALE>(o),
+                                         src,
+                                         memory_scale<SCALE>::hw);
+    }
+#endif
+
+    // Generic gathers ////////////////////////////////////////////////////////
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W <= 4), pack<T, W>> gather_scaled(
+        const T *src, const pack<OFFSET_T, W> &o)
+    {
+      return gather_loop<SCALE>(src, o);
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W <= 4), pack<T, W>> gather_scaled(
+        const T *src, const pack<OFFSET_T, W> &o, const mask<T, W> &m)
+    {
+      return gather_loop<SCALE>(src, o, m);
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W > 4), pack<T, W>> gather_scaled(
+        const T *src, const pack<OFFSET_T, W> &o)
+    {
+      using half_offset_t = pack<OFFSET_T, W / 2>;
+      return combine_halves<T, W>(
+          gather_scaled<SCALE>(src, half_offset_t(o.vl)),
+          gather_scaled<SCALE>(src, half_offset_t(o.vh)));
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W > 4), pack<T, W>> gather_scaled(
+        const T *src, const pack<OFFSET_T, W> &o, const mask<T, W> &m)
+    {
+      using half_offset_t = pack<OFFSET_T, W / 2>;
+      using half_mask_t   = mask<T, W / 2>;
+      return combine_halves<T, W>(
+          gather_scaled<SCALE>(src, half_offset_t(o.vl), half_mask_t(m.vl)),
+          gather_scaled<SCALE>(src, half_offset_t(o.vh), half_mask_t(m.vh)));
+    }
+
+    // NOTE(jda) - unsigned elements reuse the 32-bit integer gathers above
+
+    template <int SCALE, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<unsigned int, W> gather_scaled(
+        const unsigned int *src, const pack<OFFSET_T, W> &o)
+    {
+      return convert_elements_to<unsigned int>(
+          gather_scaled<SCALE>((const int *)src, o));
+    }
+
+    template <int SCALE, typename OFFSET_T, int W>
+    TSIMD_INLINE pack<unsigned int, W> gather_scaled(
+        const unsigned int *src,
+        const pack<OFFSET_T, W> &o,
+        const mask<unsigned int, W> &m)
+    {
+      return convert_elements_to<unsigned int>(
+          gather_scaled<SCALE>((const int *)src, o, m));
+    }
+
+  }  // namespace detail
+
+  // gather<>() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - 'o' holds element indices into '_src', while the SCALE
+  //             versions treat 'o' as multiples of SCALE bytes (i.e. the
+  //             stride of an array of structs) from '_src'. Masked off lanes
+  //             are set to zero.
+
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
   TSIMD_INLINE PACK_T gather(const void *_src,
                              const pack<OFFSET_T, PACK_T::static_size> &o)
   {
-    auto *src = (const typename PACK_T::element_t *)_src;
-    PACK_T result;
+    using T = typename PACK_T::element_t;
+    return detail::gather_scaled<SCALE>((const T *)_src, o);
+  }
 
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      result[i] = src[o[i]];
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather(const void *_src,
+         const pack<OFFSET_T, PACK_T::static_size> &o,
+         const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    using T = typename PACK_T::element_t;
+    return detail::gather_scaled<SCALE>((const T *)_src, o, m);
+  }
 
-    return result;
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const void *_src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    using T = typename PACK_T::element_t;
+    return gather<PACK_T, sizeof(T)>(_src, o);
   }
 
   template <typename PACK_T, typename OFFSET_T>
@@ -47,14 +561,59 @@ namespace tsimd {
          const pack<OFFSET_T, PACK_T::static_size> &o,
          const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
   {
-    auto *src = (const typename PACK_T::element_t *)_src;
-    PACK_T result;
+    using T = typename PACK_T::element_t;
+    return gather<PACK_T, sizeof(T)>(_src, o, m);
+  }
+
+  // gather<>() from half-precision storage ///////////////////////////////////
+
+  // NOTE(jda) - There are no 16-bit hardware gathers, so the 'half' elements
+  //             are collected one at a time and then converted together.
+
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const half *_src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    auto *src = (const char *)_src;
+    half gathered[PACK_T::static_size];
 
     for (int i = 0; i < PACK_T::static_size; ++i)
-      if (m[i])
-        result[i] = src[o[i]];
+      gathered[i] = *(const half *)(src + static_cast<long long>(o[i]) * SCALE);
+
+    return load<PACK_T>(gathered);
+  }
+
+  template <typename PACK_T, int SCALE, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather(const half *_src,
+         const pack<OFFSET_T, PACK_T::static_size> &o,
+         const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    auto *src = (const char *)_src;
+    half gathered[PACK_T::static_size];
+
+    for (int i = 0; i < PACK_T::static_size; ++i) {
+      const long long offset = static_cast<long long>(o[i]) * SCALE;
+      gathered[i] = m[i] ? *(const half *)(src + offset) : half();
+    }
 
-    return result;
+    return load<PACK_T>(gathered);
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T gather(const half *_src,
+                             const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    return gather<PACK_T, sizeof(half)>(_src, o);
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE PACK_T
+  gather(const half *_src,
+         const pack<OFFSET_T, PACK_T::static_size> &o,
+         const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    return gather<PACK_T, sizeof(half)>(_src, o, m);
   }
 
 }  // namespace tsimd
@@ -30,13 +30,37 @@ namespace tsimd {
 
   // load() ///////////////////////////////////////////////////////////////////
 
+  // NOTE(jda) - pack<> types without a specialization below (e.g. 8-bit and
+  //             16-bit elements in widths without a native register) are
+  //             loaded one element at a time.
+
   template <typename PACK_T>
-  TSIMD_INLINE PACK_T load(const void *_src);
+  TSIMD_INLINE PACK_T load(const void *_src)
+  {
+    auto *src = (const typename PACK_T::element_t *)_src;
+    PACK_T result;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      result[i] = src[i];
+
+    return result;
+  }
 
   template <typename PACK_T>
   TSIMD_INLINE PACK_T
   load(const void *_src,
-       const mask<typename PACK_T::element_t, PACK_T::static_size> &m);
+       const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    using T  = typename PACK_T::element_t;
+    auto *src = (const T *)_src;
+    PACK_T result(T(0));
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      if (m[i])
+        result[i] = src[i];
+
+    return result;
+  }
 
   // 1-wide //
 
@@ -75,12 +99,24 @@ namespace tsimd {
     return detail::load1<vint1>(_src);
   }
 
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src)
+  {
+    return detail::load1<vuint1>(_src);
+  }
+
   template <>
   TSIMD_INLINE vint1 load(const void *_src, const vboolf1 &m)
   {
     return detail::load1<vint1>(_src, m);
   }
 
+  template <>
+  TSIMD_INLINE vuint1 load(const void *_src, const vboolf1 &m)
+  {
+    return detail::load1<vuint1>(_src, m);
+  }
+
   template <>
   TSIMD_INLINE vdouble1 load(const void *_src)
   {
@@ -105,6 +141,75 @@ namespace tsimd {
     return detail::load1<vllong1>(_src, m);
   }
 
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE vdouble2 load(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_load_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble2::element_t *)_src;
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble2 load(const void *_src, const vboold2 &mask)
+  {
+#if defined(__AVX__)
+    return _mm_maskload_pd((const double *)_src, _mm_castpd_si128(mask));
+#else
+    auto *src = (const typename vdouble2::element_t *)_src;
+    vdouble2 result(0.0);
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong2 load(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vllong2::element_t *)_src;
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong2 load(const void *_src, const vboold2 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm_maskload_epi64((const long long *)_src,
+                              _mm_castpd_si128(mask));
+#else
+    auto *src = (const typename vllong2::element_t *)_src;
+    vllong2 result(0LL);
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   template <>
@@ -126,11 +231,15 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vfloat4 load(const void *_src, const vboolf4 &mask)
   {
-#if defined(__SSE4_2__)
+#if defined(__AVX__)
+    return _mm_maskload_ps((const float *)_src, _mm_castps_si128(mask));
+#elif defined(__SSE4_2__)
+    // NOTE(jda) - an aligned 16-byte load cannot cross a page boundary, so
+    //             loading the inactive lanes here can never fault
     return _mm_and_ps(_mm_load_ps((const float *)_src), mask);
 #else
     auto *src = (const typename vfloat4::element_t *)_src;
-    vfloat4 result;
+    vfloat4 result(0.f);
 
     for (int i = 0; i < 4; ++i)
       if (mask[i])
@@ -157,13 +266,58 @@ namespace tsimd {
   }
 
   template <>
-  TSIMD_INLINE vint4 load(const void *_src, const vboolf4 &mask)
+  TSIMD_INLINE vuint4 load(const void *_src)
   {
 #if defined(__SSE4_2__)
-    return _mm_and_si128(_mm_load_si128((const __m128i *)_src), mask);
+    return _mm_load_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vuint4::element_t *)_src;
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 load(const void *_src, const vboolf4 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm_maskload_epi32((const int *)_src, _mm_castps_si128(mask));
+#elif defined(__AVX__)
+    return _mm_castps_si128(
+        _mm_maskload_ps((const float *)_src, _mm_castps_si128(mask)));
+#elif defined(__SSE4_2__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src),
+                         _mm_castps_si128(mask));
 #else
     auto *src = (const typename vint4::element_t *)_src;
-    vint4 result;
+    vint4 result(0);
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 load(const void *_src, const vboolf4 &mask)
+  {
+#if defined(__AVX2__)
+    return _mm_maskload_epi32((const int *)_src, _mm_castps_si128(mask));
+#elif defined(__AVX__)
+    return _mm_castps_si128(
+        _mm_maskload_ps((const float *)_src, _mm_castps_si128(mask)));
+#elif defined(__SSE4_2__)
+    return _mm_and_si128(_mm_load_si128((const __m128i *)_src),
+                         _mm_castps_si128(mask));
+#else
+    auto *src = (const typename vuint4::element_t *)_src;
+    vuint4 result(0);
 
     for (int i = 0; i < 4; ++i)
       if (mask[i])
@@ -176,6 +330,9 @@ namespace tsimd {
   template <>
   TSIMD_INLINE vdouble4 load(const void *_src)
   {
+#if defined(__AVX__)
+    return _mm256_load_pd((const double *)_src);
+#else
     auto *src = (const typename vdouble4::element_t *)_src;
     vdouble4 result;
 
@@ -183,24 +340,33 @@ namespace tsimd {
       result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vdouble4 load(const void *_src, const vboold4 &mask)
   {
+#if defined(__AVX__)
+    return _mm256_maskload_pd((const double *)_src,
+                              _mm256_castpd_si256(mask));
+#else
     auto *src = (const typename vdouble4::element_t *)_src;
-    vdouble4 result;
+    vdouble4 result(0.0);
 
     for (int i = 0; i < 4; ++i)
       if (mask[i])
         result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong4 load(const void *_src)
   {
+#if defined(__AVX2__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
     auto *src = (const typename vllong4::element_t *)_src;
     vllong4 result;
 
@@ -208,19 +374,25 @@ namespace tsimd {
       result[i] = src[i];
 
     return result;
+#endif
   }
 
   template <>
   TSIMD_INLINE vllong4 load(const void *_src, const vboold4 &mask)
   {
+#if defined(__AVX2__)
+    return _mm256_maskload_epi64((const long long *)_src,
+                                 _mm256_castpd_si256(mask));
+#else
     auto *src = (const typename vllong4::element_t *)_src;
-    vllong4 result;
+    vllong4 result(0LL);
 
     for (int i = 0; i < 4; ++i)
       if (mask[i])
         result[i] = src[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -261,6 +433,17 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_castps_si256(_mm256_load_ps((const float *)_src));
+#else
+    auto *src = (const typename vuint16::element_t *)_src;
+    return vuint8(load<vuint4>(src), load<vuint4>(src + 4));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vint8 load(const void *_src, const vboolf8 &mask)
   {
@@ -276,6 +459,21 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint8 load(const void *_src, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_mask_load_epi32 (_mm256_setzero_si256(), mask, _src);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_maskload_ps((const float *)_src, _mm256_castps_si256(mask)));
+#else
+    auto *src = (const typename vuint16::element_t *)_src;
+    return vuint8(load<vuint4>(src, vboolf4(mask.vl)),
+                  load<vuint4>(src + 4, vboolf4(mask.vh)));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vdouble8 load(const void *_src)
   {
@@ -358,6 +556,17 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_load_si512((const int *)_src);
+#else
+    auto *src = (const typename vuint16::element_t *)_src;
+    return vuint16(load<vuint8>(src), load<vuint8>(src + 8));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vint16 load(const void *_src, const vboolf16 &mask)
   {
@@ -370,6 +579,18 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE vuint16 load(const void *_src, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mask_load_epi32(_mm512_setzero_epi32(), mask, _src);
+#else
+    auto *src = (const typename vuint16::element_t *)_src;
+    return vuint16(load<vuint8>(src, vboolf8(mask.vl)),
+                   load<vuint8>(src + 8, vboolf8(mask.vh)));
+#endif
+  }
+
   template <>
   TSIMD_INLINE vdouble16 load(const void *_src)
   {
@@ -400,4 +621,174 @@ namespace tsimd {
                     load<vllong8>(src + 8, vboold8(mask.vh)));
   }
 
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE vchar16 load(const void *_src)
+  {
+    return _mm_load_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load(const void *_src)
+  {
+    return _mm_load_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load(const void *_src)
+  {
+    return _mm_load_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load(const void *_src)
+  {
+    return _mm_load_si128((const __m128i *)_src);
+  }
+#endif
+
+  template <>
+  TSIMD_INLINE vchar32 load(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vchar32::element_t *)_src;
+    return vchar32(load<vchar16>(src), load<vchar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vuchar32::element_t *)_src;
+    return vuchar32(load<vuchar16>(src), load<vuchar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vshort16::element_t *)_src;
+    return vshort16(load<vshort8>(src), load<vshort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_load_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vushort16::element_t *)_src;
+    return vushort16(load<vushort8>(src), load<vushort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vchar64 load(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vchar64::element_t *)_src;
+    return vchar64(load<vchar32>(src), load<vchar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vuchar64::element_t *)_src;
+    return vuchar64(load<vuchar32>(src), load<vuchar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vshort32::element_t *)_src;
+    return vshort32(load<vshort16>(src), load<vshort16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_load_si512(_src);
+#else
+    auto *src = (const typename vushort32::element_t *)_src;
+    return vushort32(load<vushort16>(src), load<vushort16>(src + 16));
+#endif
+  }
+
+  // load() from half-precision storage ///////////////////////////////////////
+
+  // NOTE(jda) - Converts each 'half' in '_src' to a float element. Unlike the
+  //             loads above, '_src' only needs to be aligned to 2 bytes.
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load(const half *_src)
+  {
+    static_assert(std::is_same<typename PACK_T::element_t, float>::value,
+                  "half-precision data can only be loaded into float packs!");
+
+    PACK_T result;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      result[i] = _src[i];
+
+    return result;
+  }
+
+  template <>
+  TSIMD_INLINE vfloat4 load(const half *_src)
+  {
+#if defined(__F16C__)
+    return _mm_cvtph_ps(_mm_loadl_epi64((const __m128i *)_src));
+#else
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = _src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 load(const half *_src)
+  {
+#if defined(__F16C__)
+    return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)_src));
+#else
+    return vfloat8(load<vfloat4>(_src), load<vfloat4>(_src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 load(const half *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i *)_src));
+#else
+    return vfloat16(load<vfloat8>(_src), load<vfloat8>(_src + 8));
+#endif
+  }
+
 }  // namespace tsimd
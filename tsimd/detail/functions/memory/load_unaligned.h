@@ -0,0 +1,430 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "load.h"
+
+namespace tsimd {
+
+  // load_unaligned() /////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Same as load(), but without requiring '_src' to be aligned to
+  //             the size of the pack.
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T load_unaligned(const void *_src)
+  {
+    return load<PACK_T>(_src);
+  }
+
+  // 1-wide //
+
+  template <>
+  TSIMD_INLINE vfloat1 load_unaligned(const void *_src)
+  {
+    return detail::load1<vfloat1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vint1 load_unaligned(const void *_src)
+  {
+    return detail::load1<vint1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuint1 load_unaligned(const void *_src)
+  {
+    return detail::load1<vuint1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vdouble1 load_unaligned(const void *_src)
+  {
+    return detail::load1<vdouble1>(_src);
+  }
+
+  template <>
+  TSIMD_INLINE vllong1 load_unaligned(const void *_src)
+  {
+    return detail::load1<vllong1>(_src);
+  }
+
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE vdouble2 load_unaligned(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_loadu_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble2::element_t *)_src;
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong2 load_unaligned(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_loadu_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vllong2::element_t *)_src;
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE vfloat4 load_unaligned(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_loadu_ps((const float *)_src);
+#else
+    auto *src = (const typename vfloat4::element_t *)_src;
+    vfloat4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint4 load_unaligned(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_loadu_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vint4::element_t *)_src;
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 load_unaligned(const void *_src)
+  {
+#if defined(__SSE4_2__)
+    return _mm_loadu_si128((const __m128i *)_src);
+#else
+    auto *src = (const typename vuint4::element_t *)_src;
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 load_unaligned(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_loadu_pd((const double *)_src);
+#else
+    auto *src = (const typename vdouble4::element_t *)_src;
+    vdouble4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 load_unaligned(const void *_src)
+  {
+#if defined(__AVX2__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vllong4::element_t *)_src;
+    vllong4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = src[i];
+
+    return result;
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE vfloat8 load_unaligned(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_loadu_ps((const float *)_src);
+#else
+    auto *src = (const typename vfloat8::element_t *)_src;
+    return vfloat8(load_unaligned<vfloat4>(src),
+                   load_unaligned<vfloat4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 load_unaligned(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vint8::element_t *)_src;
+    return vint8(load_unaligned<vint4>(src),
+                 load_unaligned<vint4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 load_unaligned(const void *_src)
+  {
+#if defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vuint8::element_t *)_src;
+    return vuint8(load_unaligned<vuint4>(src),
+                  load_unaligned<vuint4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble8 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_loadu_pd(_src);
+#else
+    auto *src = (const typename vdouble8::element_t *)_src;
+    return vdouble8(load_unaligned<vdouble4>(src),
+                    load_unaligned<vdouble4>(src + 4));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vllong8::element_t *)_src;
+    return vllong8(load_unaligned<vllong4>(src),
+                   load_unaligned<vllong4>(src + 4));
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE vfloat16 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_loadu_ps(_src);
+#else
+    auto *src = (const typename vfloat16::element_t *)_src;
+    return vfloat16(load_unaligned<vfloat8>(src),
+                    load_unaligned<vfloat8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint16 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vint16::element_t *)_src;
+    return vint16(load_unaligned<vint8>(src),
+                  load_unaligned<vint8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512F__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vuint16::element_t *)_src;
+    return vuint16(load_unaligned<vuint8>(src),
+                   load_unaligned<vuint8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vdouble16 load_unaligned(const void *_src)
+  {
+    auto *src = (const typename vdouble16::element_t *)_src;
+    return vdouble16(load_unaligned<vdouble8>(src),
+                     load_unaligned<vdouble8>(src + 8));
+  }
+
+  template <>
+  TSIMD_INLINE vllong16 load_unaligned(const void *_src)
+  {
+    auto *src = (const typename vllong16::element_t *)_src;
+    return vllong16(load_unaligned<vllong8>(src),
+                    load_unaligned<vllong8>(src + 8));
+  }
+
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE vchar16 load_unaligned(const void *_src)
+  {
+    return _mm_loadu_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16 load_unaligned(const void *_src)
+  {
+    return _mm_loadu_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vshort8 load_unaligned(const void *_src)
+  {
+    return _mm_loadu_si128((const __m128i *)_src);
+  }
+
+  template <>
+  TSIMD_INLINE vushort8 load_unaligned(const void *_src)
+  {
+    return _mm_loadu_si128((const __m128i *)_src);
+  }
+#endif
+
+  template <>
+  TSIMD_INLINE vchar32 load_unaligned(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vchar32::element_t *)_src;
+    return vchar32(load_unaligned<vchar16>(src),
+                   load_unaligned<vchar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32 load_unaligned(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vuchar32::element_t *)_src;
+    return vuchar32(load_unaligned<vuchar16>(src),
+                    load_unaligned<vuchar16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort16 load_unaligned(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vshort16::element_t *)_src;
+    return vshort16(load_unaligned<vshort8>(src),
+                    load_unaligned<vshort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort16 load_unaligned(const void *_src)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return _mm256_loadu_si256((const __m256i *)_src);
+#else
+    auto *src = (const typename vushort16::element_t *)_src;
+    return vushort16(load_unaligned<vushort8>(src),
+                     load_unaligned<vushort8>(src + 8));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vchar64 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vchar64::element_t *)_src;
+    return vchar64(load_unaligned<vchar32>(src),
+                   load_unaligned<vchar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vuchar64::element_t *)_src;
+    return vuchar64(load_unaligned<vuchar32>(src),
+                    load_unaligned<vuchar32>(src + 32));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vshort32 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vshort32::element_t *)_src;
+    return vshort32(load_unaligned<vshort16>(src),
+                    load_unaligned<vshort16>(src + 16));
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vushort32 load_unaligned(const void *_src)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_loadu_si512(_src);
+#else
+    auto *src = (const typename vushort32::element_t *)_src;
+    return vushort32(load_unaligned<vushort16>(src),
+                     load_unaligned<vushort16>(src + 16));
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,65 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // prefetch<>() /////////////////////////////////////////////////////////////
+
+  enum class prefetch_hint
+  {
+    L1,   // prefetch into all cache levels
+    L2,   // prefetch into L2 and below
+    L3,   // prefetch into L3 only
+    NTA   // non-temporal, minimize cache pollution
+  };
+
+  template <prefetch_hint HINT = prefetch_hint::L1>
+  TSIMD_INLINE void prefetch(const void *ptr)
+  {
+#if defined(__SSE4_2__)
+    _mm_prefetch((const char *)ptr,
+                 HINT == prefetch_hint::L1
+                     ? _MM_HINT_T0
+                     : HINT == prefetch_hint::L2
+                           ? _MM_HINT_T1
+                           : HINT == prefetch_hint::L3 ? _MM_HINT_T2
+                                                       : _MM_HINT_NTA);
+#elif TSIMD_COMPILER_GNU || TSIMD_COMPILER_CLANG || TSIMD_COMPILER_INTEL
+    __builtin_prefetch(ptr,
+                       0,
+                       HINT == prefetch_hint::L1
+                           ? 3
+                           : HINT == prefetch_hint::L2
+                                 ? 2
+                                 : HINT == prefetch_hint::L3 ? 1 : 0);
+#else
+    (void)ptr;
+#endif
+  }
+
+}  // namespace tsimd
@@ -111,5 +111,16 @@ namespace tsimd {
                        reverse_bits(pack<T, 8>(p.vh)));
 #endif
   }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> reverse_bits(
+      const pack<T, W> &p)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(reverse_bits(half_t(p.vl)),
+                      reverse_bits(half_t(p.vh)));
+  }
 }
 
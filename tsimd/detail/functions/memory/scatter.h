@@ -25,18 +25,515 @@
 #pragma once
 
 #include "../../pack.h"
+#include "gather.h"
 
 namespace tsimd {
 
-  template <typename PACK_T, typename OFFSET_T>
+  namespace detail {
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_loop(const pack<T, W> &p,
+                                   T *_dst,
+                                   const pack<OFFSET_T, W> &o)
+    {
+      auto *dst = (char *)_dst;
+
+      for (int i = 0; i < W; ++i)
+        *(T *)(dst + static_cast<long long>(o[i]) * SCALE) = p[i];
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_loop(const pack<T, W> &p,
+                                   T *_dst,
+                                   const pack<OFFSET_T, W> &o,
+                                   const mask<T, W> &m)
+    {
+      auto *dst = (char *)_dst;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          *(T *)(dst + static_cast<long long>(o[i]) * SCALE) = p[i];
+    }
+
+    // Native scatters ////////////////////////////////////////////////////////
+
+    // NOTE(jda) - Like the scalar loops, scatter instructions write lanes in
+    //             order, so the highest lane wins when offsets collide.
+
+#if defined(__AVX512VL__)
+    // 32-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat4 &p,
+                                     float *dst,
+                                     const vint4 &o)
+    {
+      _mm_i32scatter_ps(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat4 &p,
+                                     float *dst,
+                                     const vint4 &o,
+                                     const vboolf4 &m)
+    {
+      _mm_mask_i32scatter_ps(dst,
+                             _mm_movemask_ps(m),
+                             scale_offsets<SCALE>(o),
+                             p,
+                             memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint4 &p, int *dst, const vint4 &o)
+    {
+      _mm_i32scatter_epi32(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint4 &p,
+                                     int *dst,
+                                     const vint4 &o,
+                                     const vboolf4 &m)
+    {
+      _mm_mask_i32scatter_epi32(dst,
+                                _mm_movemask_ps(m),
+                                scale_offsets<SCALE>(o),
+                                p,
+                                memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble4 &p,
+                                     double *dst,
+                                     const vint4 &o)
+    {
+      _mm256_i32scatter_pd(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble4 &p,
+                                     double *dst,
+                                     const vint4 &o,
+                                     const vboold4 &m)
+    {
+      _mm256_mask_i32scatter_pd(dst,
+                                _mm256_movemask_pd(m),
+                                scale_offsets<SCALE>(o),
+                                p,
+                                memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong4 &p,
+                                     long long *dst,
+                                     const vint4 &o)
+    {
+      _mm256_i32scatter_epi64(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong4 &p,
+                                     long long *dst,
+                                     const vint4 &o,
+                                     const vboold4 &m)
+    {
+      _mm256_mask_i32scatter_epi64(dst,
+                                   _mm256_movemask_pd(m),
+                                   scale_offsets<SCALE>(o),
+                                   p,
+                                   memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat8 &p,
+                                     float *dst,
+                                     const vint8 &o)
+    {
+      _mm256_i32scatter_ps(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat8 &p,
+                                     float *dst,
+                                     const vint8 &o,
+                                     const vboolf8 &m)
+    {
+      _mm256_mask_i32scatter_ps(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint8 &p, int *dst, const vint8 &o)
+    {
+      _mm256_i32scatter_epi32(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint8 &p,
+                                     int *dst,
+                                     const vint8 &o,
+                                     const vboolf8 &m)
+    {
+      _mm256_mask_i32scatter_epi32(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    // 64-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat4 &p,
+                                     float *dst,
+                                     const vllong4 &o)
+    {
+      _mm256_i64scatter_ps(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat4 &p,
+                                     float *dst,
+                                     const vllong4 &o,
+                                     const vboolf4 &m)
+    {
+      _mm256_mask_i64scatter_ps(dst,
+                                _mm_movemask_ps(m),
+                                scale_offsets<SCALE>(o),
+                                p,
+                                memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint4 &p,
+                                     int *dst,
+                                     const vllong4 &o)
+    {
+      _mm256_i64scatter_epi32(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint4 &p,
+                                     int *dst,
+                                     const vllong4 &o,
+                                     const vboolf4 &m)
+    {
+      _mm256_mask_i64scatter_epi32(dst,
+                                   _mm_movemask_ps(m),
+                                   scale_offsets<SCALE>(o),
+                                   p,
+                                   memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble4 &p,
+                                     double *dst,
+                                     const vllong4 &o)
+    {
+      _mm256_i64scatter_pd(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble4 &p,
+                                     double *dst,
+                                     const vllong4 &o,
+                                     const vboold4 &m)
+    {
+      _mm256_mask_i64scatter_pd(dst,
+                                _mm256_movemask_pd(m),
+                                scale_offsets<SCALE>(o),
+                                p,
+                                memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong4 &p,
+                                     long long *dst,
+                                     const vllong4 &o)
+    {
+      _mm256_i64scatter_epi64(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong4 &p,
+                                     long long *dst,
+                                     const vllong4 &o,
+                                     const vboold4 &m)
+    {
+      _mm256_mask_i64scatter_epi64(dst,
+                                   _mm256_movemask_pd(m),
+                                   scale_offsets<SCALE>(o),
+                                   p,
+                                   memory_scale<SCALE>::hw);
+    }
+#endif
+
+#if defined(__AVX512F__)
+    // 32-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble8 &p,
+                                     double *dst,
+                                     const vint8 &o)
+    {
+      _mm512_i32scatter_pd(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble8 &p,
+                                     double *dst,
+                                     const vint8 &o,
+                                     const vboold8 &m)
+    {
+      _mm512_mask_i32scatter_pd(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong8 &p,
+                                     long long *dst,
+                                     const vint8 &o)
+    {
+      _mm512_i32scatter_epi64(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong8 &p,
+                                     long long *dst,
+                                     const vint8 &o,
+                                     const vboold8 &m)
+    {
+      _mm512_mask_i32scatter_epi64(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat16 &p,
+                                     float *dst,
+                                     const vint16 &o)
+    {
+      _mm512_i32scatter_ps(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat16 &p,
+                                     float *dst,
+                                     const vint16 &o,
+                                     const vboolf16 &m)
+    {
+      _mm512_mask_i32scatter_ps(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint16 &p,
+                                     int *dst,
+                                     const vint16 &o)
+    {
+      _mm512_i32scatter_epi32(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint16 &p,
+                                     int *dst,
+                                     const vint16 &o,
+                                     const vboolf16 &m)
+    {
+      _mm512_mask_i32scatter_epi32(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    // 64-bit offsets //
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat8 &p,
+                                     float *dst,
+                                     const vllong8 &o)
+    {
+      _mm512_i64scatter_ps(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint8 &p,
+                                     int *dst,
+                                     const vllong8 &o)
+    {
+      _mm512_i64scatter_epi32(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+#if defined(__AVX512VL__)
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vfloat8 &p,
+                                     float *dst,
+                                     const vllong8 &o,
+                                     const vboolf8 &m)
+    {
+      _mm512_mask_i64scatter_ps(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vint8 &p,
+                                     int *dst,
+                                     const vllong8 &o,
+                                     const vboolf8 &m)
+    {
+      _mm512_mask_i64scatter_epi32(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+#endif
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble8 &p,
+                                     double *dst,
+                                     const vllong8 &o)
+    {
+      _mm512_i64scatter_pd(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vdouble8 &p,
+                                     double *dst,
+                                     const vllong8 &o,
+                                     const vboold8 &m)
+    {
+      _mm512_mask_i64scatter_pd(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong8 &p,
+                                     long long *dst,
+                                     const vllong8 &o)
+    {
+      _mm512_i64scatter_epi64(
+          dst, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+
+    template <int SCALE>
+    TSIMD_INLINE void scatter_scaled(const vllong8 &p,
+                                     long long *dst,
+                                     const vllong8 &o,
+                                     const vboold8 &m)
+    {
+      _mm512_mask_i64scatter_epi64(
+          dst, m, scale_offsets<SCALE>(o), p, memory_scale<SCALE>::hw);
+    }
+#endif
+
+    // Generic scatters ///////////////////////////////////////////////////////
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W <= 4)> scatter_scaled(
+        const pack<T, W> &p, T *dst, const pack<OFFSET_T, W> &o)
+    {
+      scatter_loop<SCALE>(p, dst, o);
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W <= 4)> scatter_scaled(
+        const pack<T, W> &p,
+        T *dst,
+        const pack<OFFSET_T, W> &o,
+        const mask<T, W> &m)
+    {
+      scatter_loop<SCALE>(p, dst, o, m);
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W > 4)> scatter_scaled(
+        const pack<T, W> &p, T *dst, const pack<OFFSET_T, W> &o)
+    {
+      using half_pack_t   = pack<T, W / 2>;
+      using half_offset_t = pack<OFFSET_T, W / 2>;
+      scatter_scaled<SCALE>(half_pack_t(p.vl), dst, half_offset_t(o.vl));
+      scatter_scaled<SCALE>(half_pack_t(p.vh), dst, half_offset_t(o.vh));
+    }
+
+    template <int SCALE, typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE traits::enable_if_t<(W > 4)> scatter_scaled(
+        const pack<T, W> &p,
+        T *dst,
+        const pack<OFFSET_T, W> &o,
+        const mask<T, W> &m)
+    {
+      using half_pack_t   = pack<T, W / 2>;
+      using half_offset_t = pack<OFFSET_T, W / 2>;
+      using half_mask_t   = mask<T, W / 2>;
+      scatter_scaled<SCALE>(
+          half_pack_t(p.vl), dst, half_offset_t(o.vl), half_mask_t(m.vl));
+      scatter_scaled<SCALE>(
+          half_pack_t(p.vh), dst, half_offset_t(o.vh), half_mask_t(m.vh));
+    }
+
+    // NOTE(jda) - unsigned elements reuse the 32-bit integer scatters above
+
+    template <int SCALE, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_scaled(const pack<unsigned int, W> &p,
+                                     unsigned int *dst,
+                                     const pack<OFFSET_T, W> &o)
+    {
+      scatter_scaled<SCALE>(convert_elements_to<int>(p), (int *)dst, o);
+    }
+
+    template <int SCALE, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_scaled(const pack<unsigned int, W> &p,
+                                     unsigned int *dst,
+                                     const pack<OFFSET_T, W> &o,
+                                     const mask<unsigned int, W> &m)
+    {
+      scatter_scaled<SCALE>(convert_elements_to<int>(p), (int *)dst, o, m);
+    }
+
+  }  // namespace detail
+
+  // scatter<>() //////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Offsets are interpreted the same way as gather<>(): element
+  //             indices by default, or multiples of SCALE bytes.
+
+  template <int SCALE, typename PACK_T, typename OFFSET_T>
   TSIMD_INLINE void scatter(const PACK_T &p,
                             void *_dst,
                             const pack<OFFSET_T, PACK_T::static_size> &o)
   {
-    auto *dst = (typename PACK_T::element_t *)_dst;
+    using T = typename PACK_T::element_t;
+    detail::scatter_scaled<SCALE>(p, (T *)_dst, o);
+  }
+
+  template <int SCALE, typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter(
+      const PACK_T &p,
+      void *_dst,
+      const pack<OFFSET_T, PACK_T::static_size> &o,
+      const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    using T = typename PACK_T::element_t;
+    detail::scatter_scaled<SCALE>(p, (T *)_dst, o, m);
+  }
 
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      dst[o[i]] = p[i];
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter(const PACK_T &p,
+                            void *_dst,
+                            const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    using T = typename PACK_T::element_t;
+    scatter<sizeof(T)>(p, _dst, o);
   }
 
   template <typename PACK_T, typename OFFSET_T>
@@ -46,11 +543,8 @@ namespace tsimd {
       const pack<OFFSET_T, PACK_T::static_size> &o,
       const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
   {
-    auto *dst = (typename PACK_T::element_t *)_dst;
-
-    for (int i = 0; i < PACK_T::static_size; ++i)
-      if (m[i])
-        dst[o[i]] = p[i];
+    using T = typename PACK_T::element_t;
+    scatter<sizeof(T)>(p, _dst, o, m);
   }
 
 }  // namespace tsimd
@@ -0,0 +1,204 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    template <typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_add_loop(const pack<T, W> &p,
+                                       T *dst,
+                                       const pack<OFFSET_T, W> &o,
+                                       const mask<T, W> &m)
+    {
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          dst[o[i]] += p[i];
+    }
+
+    template <typename T, typename OFFSET_T, int W>
+    TSIMD_INLINE void scatter_add_impl(const pack<T, W> &p,
+                                       T *dst,
+                                       const pack<OFFSET_T, W> &o,
+                                       const mask<T, W> &m)
+    {
+      scatter_add_loop(p, dst, o, m);
+    }
+
+    // Native conflict-resolving scatter-adds /////////////////////////////////
+
+    // NOTE(jda) - each active lane first picks up the values of the earlier
+    //             active lanes writing the same offset (found with vpconflict,
+    //             highest one first via vplzcnt). Only the last lane for each
+    //             offset then does the read-modify-write, so the result never
+    //             depends on which colliding lane the scatter keeps.
+
+#if defined(__AVX512CD__)
+    TSIMD_INLINE void scatter_add_impl(const vfloat16 &p,
+                                       float *dst,
+                                       const vint16 &o,
+                                       const vboolf16 &m)
+    {
+      const __m512i one = _mm512_set1_epi32(1);
+      const __m512i top = _mm512_set1_epi32(31);
+
+      __m512i todo = _mm512_and_si512(_mm512_maskz_conflict_epi32(m, o),
+                                      _mm512_set1_epi32(__mmask16(m)));
+      const __mmask16 last = m & ~_mm512_reduce_or_epi32(todo);
+
+      __m512 sum       = _mm512_maskz_mov_ps(m, p);
+      __mmask16 active = _mm512_test_epi32_mask(todo, todo);
+
+      while (active) {
+        const __m512i src = _mm512_sub_epi32(top, _mm512_lzcnt_epi32(todo));
+        sum  = _mm512_mask_add_ps(sum, active, sum,
+                                  _mm512_permutexvar_ps(src, p));
+        todo = _mm512_andnot_si512(_mm512_sllv_epi32(one, src), todo);
+        active = _mm512_test_epi32_mask(todo, todo);
+      }
+
+      const __m512 old =
+          _mm512_mask_i32gather_ps(_mm512_setzero_ps(), last, o, dst, 4);
+      _mm512_mask_i32scatter_ps(dst, last, o, _mm512_add_ps(old, sum), 4);
+    }
+
+    TSIMD_INLINE void scatter_add_impl(const vint16 &p,
+                                       int *dst,
+                                       const vint16 &o,
+                                       const vboolf16 &m)
+    {
+      const __m512i one = _mm512_set1_epi32(1);
+      const __m512i top = _mm512_set1_epi32(31);
+
+      __m512i todo = _mm512_and_si512(_mm512_maskz_conflict_epi32(m, o),
+                                      _mm512_set1_epi32(__mmask16(m)));
+      const __mmask16 last = m & ~_mm512_reduce_or_epi32(todo);
+
+      __m512i sum      = _mm512_maskz_mov_epi32(m, p);
+      __mmask16 active = _mm512_test_epi32_mask(todo, todo);
+
+      while (active) {
+        const __m512i src = _mm512_sub_epi32(top, _mm512_lzcnt_epi32(todo));
+        sum  = _mm512_mask_add_epi32(sum, active, sum,
+                                     _mm512_permutexvar_epi32(src, p));
+        todo = _mm512_andnot_si512(_mm512_sllv_epi32(one, src), todo);
+        active = _mm512_test_epi32_mask(todo, todo);
+      }
+
+      const __m512i old =
+          _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), last, o, dst, 4);
+      _mm512_mask_i32scatter_epi32(dst, last, o, _mm512_add_epi32(old, sum), 4);
+    }
+
+    TSIMD_INLINE void scatter_add_impl(const vdouble8 &p,
+                                       double *dst,
+                                       const vllong8 &o,
+                                       const vboold8 &m)
+    {
+      const __m512i one = _mm512_set1_epi64(1);
+      const __m512i top = _mm512_set1_epi64(63);
+
+      __m512i todo = _mm512_and_si512(_mm512_maskz_conflict_epi64(m, o),
+                                      _mm512_set1_epi64(__mmask8(m)));
+      const __mmask8 last = m & ~_mm512_reduce_or_epi64(todo);
+
+      __m512d sum     = _mm512_maskz_mov_pd(m, p);
+      __mmask8 active = _mm512_test_epi64_mask(todo, todo);
+
+      while (active) {
+        const __m512i src = _mm512_sub_epi64(top, _mm512_lzcnt_epi64(todo));
+        sum  = _mm512_mask_add_pd(sum, active, sum,
+                                  _mm512_permutexvar_pd(src, p));
+        todo = _mm512_andnot_si512(_mm512_sllv_epi64(one, src), todo);
+        active = _mm512_test_epi64_mask(todo, todo);
+      }
+
+      const __m512d old =
+          _mm512_mask_i64gather_pd(_mm512_setzero_pd(), last, o, dst, 8);
+      _mm512_mask_i64scatter_pd(dst, last, o, _mm512_add_pd(old, sum), 8);
+    }
+
+    TSIMD_INLINE void scatter_add_impl(const vllong8 &p,
+                                       long long *dst,
+                                       const vllong8 &o,
+                                       const vboold8 &m)
+    {
+      const __m512i one = _mm512_set1_epi64(1);
+      const __m512i top = _mm512_set1_epi64(63);
+
+      __m512i todo = _mm512_and_si512(_mm512_maskz_conflict_epi64(m, o),
+                                      _mm512_set1_epi64(__mmask8(m)));
+      const __mmask8 last = m & ~_mm512_reduce_or_epi64(todo);
+
+      __m512i sum     = _mm512_maskz_mov_epi64(m, p);
+      __mmask8 active = _mm512_test_epi64_mask(todo, todo);
+
+      while (active) {
+        const __m512i src = _mm512_sub_epi64(top, _mm512_lzcnt_epi64(todo));
+        sum  = _mm512_mask_add_epi64(sum, active, sum,
+                                     _mm512_permutexvar_epi64(src, p));
+        todo = _mm512_andnot_si512(_mm512_sllv_epi64(one, src), todo);
+        active = _mm512_test_epi64_mask(todo, todo);
+      }
+
+      const __m512i old =
+          _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), last, o, dst, 8);
+      _mm512_mask_i64scatter_epi64(dst, last, o, _mm512_add_epi64(old, sum), 8);
+    }
+#endif
+
+  }  // namespace detail
+
+  // scatter_add() ////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Adds each active lane of 'p' into element 'o[i]' of '_dst'
+  //             (offsets are element indices). Unlike scatter(), lanes with
+  //             the same offset are all accumulated instead of the highest
+  //             one winning.
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter_add(
+      const PACK_T &p,
+      void *_dst,
+      const pack<OFFSET_T, PACK_T::static_size> &o,
+      const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    using T = typename PACK_T::element_t;
+    detail::scatter_add_impl(p, (T *)_dst, o, m);
+  }
+
+  template <typename PACK_T, typename OFFSET_T>
+  TSIMD_INLINE void scatter_add(const PACK_T &p,
+                                void *_dst,
+                                const pack<OFFSET_T, PACK_T::static_size> &o)
+  {
+    using mask_t = mask<typename PACK_T::element_t, PACK_T::static_size>;
+    scatter_add(p, _dst, o, mask_t(true));
+  }
+
+}  // namespace tsimd
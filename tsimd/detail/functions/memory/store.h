@@ -31,14 +31,30 @@ namespace tsimd {
 
   // store() //////////////////////////////////////////////////////////////////
 
+  // NOTE(jda) - like load(), unspecialized pack<> types are stored one
+  //             element at a time.
+
   template <typename PACK_T>
-  TSIMD_INLINE void store(const PACK_T &p, void *_dst);
+  TSIMD_INLINE void store(const PACK_T &p, void *_dst)
+  {
+    auto *dst = (typename PACK_T::element_t *)_dst;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      dst[i] = p[i];
+  }
 
   template <typename PACK_T>
   TSIMD_INLINE void store(
       const PACK_T &p,
       void *_dst,
-      const mask<typename PACK_T::element_t, PACK_T::static_size> &m);
+      const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    auto *dst = (typename PACK_T::element_t *)_dst;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      if (m[i])
+        dst[i] = p[i];
+  }
 
   // 1-wide //
 
@@ -49,12 +65,70 @@ namespace tsimd {
   }
 
   template <typename T>
-  TSIMD_INLINE void store(const pack<T, 1> &v, void *_dst, const vboolf1 &mask)
+  TSIMD_INLINE void store(const pack<T, 1> &v,
+                          void *_dst,
+                          const mask<T, 1> &mask)
   {
     if (mask[0])
       *((T *)_dst) = v[0];
   }
 
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE void store(const vdouble2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_store_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vdouble2 &v, void *_dst, const vboold2 &mask)
+  {
+#if defined(__AVX__)
+    _mm_maskstore_pd((double *)_dst, _mm_castpd_si128(mask), v);
+#else
+    auto *dst = (typename vdouble2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vllong2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vllong2 &v, void *_dst, const vboold2 &mask)
+  {
+#if defined(__AVX2__)
+    _mm_maskstore_epi64((long long *)_dst, _mm_castpd_si128(mask), v);
+#else
+    auto *dst = (typename vllong2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
   // 4-wide //
 
   template <>
@@ -73,8 +147,8 @@ namespace tsimd {
   template <>
   TSIMD_INLINE void store(const vfloat4 &v, void *_dst, const vboolf4 &mask)
   {
-#if defined(__SSE4_2__)
-    store(select(mask, v, load<vfloat4>(_dst)), _dst);
+#if defined(__AVX__)
+    _mm_maskstore_ps((float *)_dst, _mm_castps_si128(mask), v);
 #else
     auto *dst = (typename vfloat4::element_t *)_dst;
 
@@ -98,10 +172,26 @@ namespace tsimd {
   }
 
   template <>
-  TSIMD_INLINE void store(const vint4 &v, void *_dst, const vboolf4 &mask)
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst)
   {
 #if defined(__SSE4_2__)
-    store(select(mask, v, load<vint4>(_dst)), _dst);
+    _mm_store_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vuint4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vint4 &v, void *_dst, const vboolf4 &mask)
+  {
+#if defined(__AVX2__)
+    _mm_maskstore_epi32((int *)_dst, _mm_castps_si128(mask), v);
+#elif defined(__AVX__)
+    _mm_maskstore_ps(
+        (float *)_dst, _mm_castps_si128(mask), _mm_castsi128_ps(v));
 #else
     auto *dst = (typename vint4::element_t *)_dst;
 
@@ -111,34 +201,75 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint4 &v, void *_dst, const vboolf4 &mask)
+  {
+#if defined(__AVX2__)
+    _mm_maskstore_epi32((int *)_dst, _mm_castps_si128(mask), v);
+#elif defined(__AVX__)
+    _mm_maskstore_ps(
+        (float *)_dst, _mm_castps_si128(mask), _mm_castsi128_ps(v));
+#else
+    auto *dst = (typename vuint4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vdouble4 &v, void *_dst)
   {
+#if defined(__AVX__)
+    _mm256_store_pd((double *)_dst, v);
+#else
     auto *dst = (typename vdouble4::element_t *)_dst;
 
     for (int i = 0; i < 4; ++i)
       dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vdouble4 &v, void *_dst, const vboold4 &mask)
   {
-    store(select(mask, v, load<vdouble4>(_dst)), _dst);
+#if defined(__AVX__)
+    _mm256_maskstore_pd((double *)_dst, _mm256_castpd_si256(mask), v);
+#else
+    auto *dst = (typename vdouble4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong4 &v, void *_dst)
   {
+#if defined(__AVX2__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
     auto *dst = (typename vllong4::element_t *)_dst;
 
     for (int i = 0; i < 4; ++i)
       dst[i] = v[i];
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong4 &v, void *_dst, const vboold4 &mask)
   {
-    store(select(mask, v, load<vllong4>(_dst)), _dst);
+#if defined(__AVX2__)
+    _mm256_maskstore_epi64((long long *)_dst, _mm256_castpd_si256(mask), v);
+#else
+    auto *dst = (typename vllong4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      if (mask[i])
+        dst[i] = v[i];
+#endif
   }
 
   // 8-wide //
@@ -183,6 +314,20 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst)
+  {
+#if defined(__AVX2__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#elif defined(__AVX__)
+    _mm256_store_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vuint8::element_t *)_dst;
+    store(vuint4(v.vl), dst);
+    store(vuint4(v.vh), dst + 4);
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vint8 &v, void *_dst, const vboolf8 &mask)
   {
@@ -199,36 +344,68 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint8 &v, void *_dst, const vboolf8 &mask)
+  {
+#if defined(__AVX512VL__)
+    _mm256_mask_store_epi32(_dst, mask, v);
+#elif defined(__AVX2__)
+    _mm256_maskstore_epi32((int*)_dst, mask, v);
+#elif defined(__AVX__)
+    _mm256_maskstore_ps((float *)_dst, mask, v);
+#else
+    auto *dst = (typename vuint8::element_t *)_dst;
+    store(vuint4(v.vl), dst, vboolf4(mask.vl));
+    store(vuint4(v.vh), dst + 4, vboolf4(mask.vh));
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vdouble8 &v, void *_dst)
   {
+#if defined(__AVX512F__)
+    _mm512_store_pd(_dst, v);
+#else
     auto *dst = (typename vdouble8::element_t *)_dst;
     store(vdouble4(v.vl), dst);
     store(vdouble4(v.vh), dst + 4);
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vdouble8 &v, void *_dst, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    _mm512_mask_store_pd(_dst, mask, v);
+#else
     auto *dst = (typename vdouble8::element_t *)_dst;
     store(vdouble4(v.vl), dst, vboold4(mask.vl));
     store(vdouble4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong8 &v, void *_dst)
   {
+#if defined(__AVX512F__)
+    _mm512_store_epi64(_dst, v);
+#else
     auto *dst = (typename vllong8::element_t *)_dst;
     store(vllong4(v.vl), dst);
     store(vllong4(v.vh), dst + 4);
+#endif
   }
 
   template <>
   TSIMD_INLINE void store(const vllong8 &v, void *_dst, const vboold8 &mask)
   {
+#if defined(__AVX512F__)
+    _mm512_mask_store_epi64(_dst, mask, v);
+#else
     auto *dst = (typename vllong8::element_t *)_dst;
     store(vllong4(v.vl), dst, vboold4(mask.vl));
     store(vllong4(v.vh), dst + 4, vboold4(mask.vh));
+#endif
   }
 
   // 16-wide //
@@ -269,6 +446,18 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vuint16::element_t *)_dst;
+    store(vuint8(v.vl), dst);
+    store(vuint8(v.vh), dst + 8);
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vint16 &v, void *_dst, const vboolf16 &mask)
   {
@@ -281,6 +470,18 @@ namespace tsimd {
 #endif
   }
 
+  template <>
+  TSIMD_INLINE void store(const vuint16 &v, void *_dst, const vboolf16 &mask)
+  {
+#if defined(__AVX512F__)
+    _mm512_mask_store_epi32(_dst, mask, v);
+#else
+    auto *dst = (typename vuint16::element_t *)_dst;
+    store(vuint8(v.vl), dst, vboolf8(mask.vl));
+    store(vuint8(v.vh), dst + 8, vboolf8(mask.vh));
+#endif
+  }
+
   template <>
   TSIMD_INLINE void store(const vdouble16 &v, void *_dst)
   {
@@ -313,4 +514,179 @@ namespace tsimd {
     store(vllong8(v.vh), dst + 8, vboold8(mask.vh));
   }
 
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE void store(const vchar16 &v, void *_dst)
+  {
+    _mm_store_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar16 &v, void *_dst)
+  {
+    _mm_store_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort8 &v, void *_dst)
+  {
+    _mm_store_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort8 &v, void *_dst)
+  {
+    _mm_store_si128((__m128i *)_dst, v);
+  }
+#endif
+
+  template <>
+  TSIMD_INLINE void store(const vchar32 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vchar32::element_t *)_dst;
+    store(vchar16(v.vl), dst);
+    store(vchar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar32 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vuchar32::element_t *)_dst;
+    store(vuchar16(v.vl), dst);
+    store(vuchar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort16 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vshort16::element_t *)_dst;
+    store(vshort8(v.vl), dst);
+    store(vshort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort16 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_store_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vushort16::element_t *)_dst;
+    store(vushort8(v.vl), dst);
+    store(vushort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vchar64 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vchar64::element_t *)_dst;
+    store(vchar32(v.vl), dst);
+    store(vchar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vuchar64 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vuchar64::element_t *)_dst;
+    store(vuchar32(v.vl), dst);
+    store(vuchar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vshort32 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vshort32::element_t *)_dst;
+    store(vshort16(v.vl), dst);
+    store(vshort16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vushort32 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_store_si512(_dst, v);
+#else
+    auto *dst = (typename vushort32::element_t *)_dst;
+    store(vushort16(v.vl), dst);
+    store(vushort16(v.vh), dst + 16);
+#endif
+  }
+
+  // store() to half-precision storage ////////////////////////////////////////
+
+  // NOTE(jda) - Rounds each float element to the nearest 'half' (ties to
+  //             even). '_dst' only needs to be aligned to 2 bytes.
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store(const PACK_T &p, half *_dst)
+  {
+    static_assert(std::is_same<typename PACK_T::element_t, float>::value,
+                  "only float packs can be stored as half-precision data!");
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      _dst[i] = half(p[i]);
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat4 &v, half *_dst)
+  {
+#if defined(__F16C__)
+    _mm_storel_epi64((__m128i *)_dst,
+                     _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+    for (int i = 0; i < 4; ++i)
+      _dst[i] = half(v[i]);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat8 &v, half *_dst)
+  {
+#if defined(__F16C__)
+    _mm_storeu_si128((__m128i *)_dst,
+                     _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+    store(vfloat4(v.vl), _dst);
+    store(vfloat4(v.vh), _dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store(const vfloat16 &v, half *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm256_storeu_si256((__m256i *)_dst,
+                        _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+    store(vfloat8(v.vl), _dst);
+    store(vfloat8(v.vh), _dst + 8);
+#endif
+  }
+
 }  // namespace tsimd
\ No newline at end of file
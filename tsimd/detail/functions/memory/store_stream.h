@@ -0,0 +1,252 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "store.h"
+
+namespace tsimd {
+
+  // store_stream() ///////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Non-temporal store which bypasses the cache hierarchy, meant
+  //             for large write-once outputs which won't be read again soon.
+  //             '_dst' must be aligned like store(). Streaming stores are
+  //             weakly ordered, so call stream_fence() before other threads
+  //             consume the written data.
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store_stream(const PACK_T &p, void *_dst)
+  {
+    store(p, _dst);
+  }
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE void store_stream(const pack<T, 1> &v, void *_dst)
+  {
+    *((T *)_dst) = v[0];
+  }
+
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE void store_stream(const vdouble2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_stream_pd((double *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vllong2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_stream_si128((__m128i *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE void store_stream(const vfloat4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_stream_ps((float *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vint4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_stream_si128((__m128i *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vuint4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_stream_si128((__m128i *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vdouble4 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_stream_pd((double *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vllong4 &v, void *_dst)
+  {
+#if defined(__AVX2__)
+    _mm256_stream_si256((__m256i *)_dst, v);
+#else
+    store(v, _dst);
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE void store_stream(const vfloat8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_stream_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vfloat8::element_t *)_dst;
+    store_stream(vfloat4(v.vl), dst);
+    store_stream(vfloat4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vint8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_stream_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vint8::element_t *)_dst;
+    store_stream(vint4(v.vl), dst);
+    store_stream(vint4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vuint8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_stream_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vuint8::element_t *)_dst;
+    store_stream(vuint4(v.vl), dst);
+    store_stream(vuint4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vdouble8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_stream_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble8::element_t *)_dst;
+    store_stream(vdouble4(v.vl), dst);
+    store_stream(vdouble4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vllong8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_stream_si512((__m512i *)_dst, v);
+#else
+    auto *dst = (typename vllong8::element_t *)_dst;
+    store_stream(vllong4(v.vl), dst);
+    store_stream(vllong4(v.vh), dst + 4);
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE void store_stream(const vfloat16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_stream_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vfloat16::element_t *)_dst;
+    store_stream(vfloat8(v.vl), dst);
+    store_stream(vfloat8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_stream_si512((__m512i *)_dst, v);
+#else
+    auto *dst = (typename vint16::element_t *)_dst;
+    store_stream(vint8(v.vl), dst);
+    store_stream(vint8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vuint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_stream_si512((__m512i *)_dst, v);
+#else
+    auto *dst = (typename vuint16::element_t *)_dst;
+    store_stream(vuint8(v.vl), dst);
+    store_stream(vuint8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vdouble16 &v, void *_dst)
+  {
+    auto *dst = (typename vdouble16::element_t *)_dst;
+    store_stream(vdouble8(v.vl), dst);
+    store_stream(vdouble8(v.vh), dst + 8);
+  }
+
+  template <>
+  TSIMD_INLINE void store_stream(const vllong16 &v, void *_dst)
+  {
+    auto *dst = (typename vllong16::element_t *)_dst;
+    store_stream(vllong8(v.vl), dst);
+    store_stream(vllong8(v.vh), dst + 8);
+  }
+
+  // stream_fence() ///////////////////////////////////////////////////////////
+
+  TSIMD_INLINE void stream_fence()
+  {
+#if defined(__SSE4_2__)
+    _mm_sfence();
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,385 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "store.h"
+
+namespace tsimd {
+
+  // store_unaligned() ////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Same as store(), but without requiring '_dst' to be aligned to
+  //             the size of the pack.
+
+  template <typename PACK_T>
+  TSIMD_INLINE void store_unaligned(const PACK_T &p, void *_dst)
+  {
+    store(p, _dst);
+  }
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE void store_unaligned(const pack<T, 1> &v, void *_dst)
+  {
+    *((T *)_dst) = v[0];
+  }
+
+  // 2-wide //
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vdouble2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_storeu_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vllong2 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_storeu_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vllong2::element_t *)_dst;
+
+    for (int i = 0; i < 2; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  // 4-wide //
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vfloat4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_storeu_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vfloat4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vint4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_storeu_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vint4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuint4 &v, void *_dst)
+  {
+#if defined(__SSE4_2__)
+    _mm_storeu_si128((__m128i *)_dst, v);
+#else
+    auto *dst = (typename vuint4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vdouble4 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_storeu_pd((double *)_dst, v);
+#else
+    auto *dst = (typename vdouble4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vllong4 &v, void *_dst)
+  {
+#if defined(__AVX2__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vllong4::element_t *)_dst;
+
+    for (int i = 0; i < 4; ++i)
+      dst[i] = v[i];
+#endif
+  }
+
+  // 8-wide //
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vfloat8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_storeu_ps((float *)_dst, v);
+#else
+    auto *dst = (typename vfloat8::element_t *)_dst;
+    store_unaligned(vfloat4(v.vl), dst);
+    store_unaligned(vfloat4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vint8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vint8::element_t *)_dst;
+    store_unaligned(vint4(v.vl), dst);
+    store_unaligned(vint4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuint8 &v, void *_dst)
+  {
+#if defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vuint8::element_t *)_dst;
+    store_unaligned(vuint4(v.vl), dst);
+    store_unaligned(vuint4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vdouble8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_storeu_pd(_dst, v);
+#else
+    auto *dst = (typename vdouble8::element_t *)_dst;
+    store_unaligned(vdouble4(v.vl), dst);
+    store_unaligned(vdouble4(v.vh), dst + 4);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vllong8 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vllong8::element_t *)_dst;
+    store_unaligned(vllong4(v.vl), dst);
+    store_unaligned(vllong4(v.vh), dst + 4);
+#endif
+  }
+
+  // 16-wide //
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vfloat16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_storeu_ps(_dst, v);
+#else
+    auto *dst = (typename vfloat16::element_t *)_dst;
+    store_unaligned(vfloat8(v.vl), dst);
+    store_unaligned(vfloat8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vint16::element_t *)_dst;
+    store_unaligned(vint8(v.vl), dst);
+    store_unaligned(vint8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuint16 &v, void *_dst)
+  {
+#if defined(__AVX512F__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vuint16::element_t *)_dst;
+    store_unaligned(vuint8(v.vl), dst);
+    store_unaligned(vuint8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vdouble16 &v, void *_dst)
+  {
+    auto *dst = (typename vdouble16::element_t *)_dst;
+    store_unaligned(vdouble8(v.vl), dst);
+    store_unaligned(vdouble8(v.vh), dst + 8);
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vllong16 &v, void *_dst)
+  {
+    auto *dst = (typename vllong16::element_t *)_dst;
+    store_unaligned(vllong8(v.vl), dst);
+    store_unaligned(vllong8(v.vh), dst + 8);
+  }
+
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE void store_unaligned(const vchar16 &v, void *_dst)
+  {
+    _mm_storeu_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuchar16 &v, void *_dst)
+  {
+    _mm_storeu_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vshort8 &v, void *_dst)
+  {
+    _mm_storeu_si128((__m128i *)_dst, v);
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vushort8 &v, void *_dst)
+  {
+    _mm_storeu_si128((__m128i *)_dst, v);
+  }
+#endif
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vchar32 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vchar32::element_t *)_dst;
+    store_unaligned(vchar16(v.vl), dst);
+    store_unaligned(vchar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuchar32 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vuchar32::element_t *)_dst;
+    store_unaligned(vuchar16(v.vl), dst);
+    store_unaligned(vuchar16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vshort16 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vshort16::element_t *)_dst;
+    store_unaligned(vshort8(v.vl), dst);
+    store_unaligned(vshort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vushort16 &v, void *_dst)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    _mm256_storeu_si256((__m256i *)_dst, v);
+#else
+    auto *dst = (typename vushort16::element_t *)_dst;
+    store_unaligned(vushort8(v.vl), dst);
+    store_unaligned(vushort8(v.vh), dst + 8);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vchar64 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vchar64::element_t *)_dst;
+    store_unaligned(vchar32(v.vl), dst);
+    store_unaligned(vchar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vuchar64 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vuchar64::element_t *)_dst;
+    store_unaligned(vuchar32(v.vl), dst);
+    store_unaligned(vuchar32(v.vh), dst + 32);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vshort32 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vshort32::element_t *)_dst;
+    store_unaligned(vshort16(v.vl), dst);
+    store_unaligned(vshort16(v.vh), dst + 16);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE void store_unaligned(const vushort32 &v, void *_dst)
+  {
+#if defined(__AVX512BW__)
+    _mm512_storeu_si512(_dst, v);
+#else
+    auto *dst = (typename vushort32::element_t *)_dst;
+    store_unaligned(vushort16(v.vl), dst);
+    store_unaligned(vushort16(v.vh), dst + 16);
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,91 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "shuffle.h"
+
+namespace tsimd {
+
+  // broadcast<>() ////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Returns a pack with every lane set to p[LANE].
+
+  namespace detail {
+
+    template <int LANE, typename T, int W>
+    TSIMD_INLINE pack<T, W> broadcast_impl(const pack<T, W> &p)
+    {
+      return permute(p, pack<int, W>(LANE));
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vfloat4 broadcast_impl(const vfloat4 &p)
+    {
+      return shuffle<LANE, LANE, LANE, LANE>(p);
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vint4 broadcast_impl(const vint4 &p)
+    {
+      return shuffle<LANE, LANE, LANE, LANE>(p);
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vdouble4 broadcast_impl(const vdouble4 &p)
+    {
+      return shuffle<LANE, LANE, LANE, LANE>(p);
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vllong4 broadcast_impl(const vllong4 &p)
+    {
+      return shuffle<LANE, LANE, LANE, LANE>(p);
+    }
+
+    template <int LANE>
+    TSIMD_INLINE vfloat8 broadcast_impl(const vfloat8 &p)
+    {
+#if defined(__AVX2__)
+      return _mm256_permutevar8x32_ps(p, _mm256_set1_epi32(LANE));
+#elif defined(__AVX__)
+      const __m256 t = _mm256_permute_ps(p, (LANE & 3) * 0x55);
+      return _mm256_permute2f128_ps(t, t, LANE < 4 ? 0x00 : 0x11);
+#else
+      return permute(p, vint8(LANE));
+#endif
+    }
+
+  }  // namespace detail
+
+  template <int LANE, typename T, int W>
+  TSIMD_INLINE pack<T, W> broadcast(const pack<T, W> &p)
+  {
+    static_assert(LANE >= 0 && LANE < W,
+                  "broadcast<>() lane must be inside of the pack!");
+    return detail::broadcast_impl<LANE>(p);
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,443 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    // NOTE(jda) - compress_lut()[m] holds the source lane of each active lane
+    //             in the 8-bit mask 'm', one nibble per output lane (the
+    //             lowest nibble is the first active lane). Unused nibbles are
+    //             0. The 4-wide versions use the first 16 entries.
+    TSIMD_INLINE const uint32_t *compress_lut()
+    {
+      static const uint32_t lut[256] = {
+        0x00000000, 0x00000000, 0x00000001, 0x00000010, 0x00000002, 0x00000020,
+        0x00000021, 0x00000210, 0x00000003, 0x00000030, 0x00000031, 0x00000310,
+        0x00000032, 0x00000320, 0x00000321, 0x00003210, 0x00000004, 0x00000040,
+        0x00000041, 0x00000410, 0x00000042, 0x00000420, 0x00000421, 0x00004210,
+        0x00000043, 0x00000430, 0x00000431, 0x00004310, 0x00000432, 0x00004320,
+        0x00004321, 0x00043210, 0x00000005, 0x00000050, 0x00000051, 0x00000510,
+        0x00000052, 0x00000520, 0x00000521, 0x00005210, 0x00000053, 0x00000530,
+        0x00000531, 0x00005310, 0x00000532, 0x00005320, 0x00005321, 0x00053210,
+        0x00000054, 0x00000540, 0x00000541, 0x00005410, 0x00000542, 0x00005420,
+        0x00005421, 0x00054210, 0x00000543, 0x00005430, 0x00005431, 0x00054310,
+        0x00005432, 0x00054320, 0x00054321, 0x00543210, 0x00000006, 0x00000060,
+        0x00000061, 0x00000610, 0x00000062, 0x00000620, 0x00000621, 0x00006210,
+        0x00000063, 0x00000630, 0x00000631, 0x00006310, 0x00000632, 0x00006320,
+        0x00006321, 0x00063210, 0x00000064, 0x00000640, 0x00000641, 0x00006410,
+        0x00000642, 0x00006420, 0x00006421, 0x00064210, 0x00000643, 0x00006430,
+        0x00006431, 0x00064310, 0x00006432, 0x00064320, 0x00064321, 0x00643210,
+        0x00000065, 0x00000650, 0x00000651, 0x00006510, 0x00000652, 0x00006520,
+        0x00006521, 0x00065210, 0x00000653, 0x00006530, 0x00006531, 0x00065310,
+        0x00006532, 0x00065320, 0x00065321, 0x00653210, 0x00000654, 0x00006540,
+        0x00006541, 0x00065410, 0x00006542, 0x00065420, 0x00065421, 0x00654210,
+        0x00006543, 0x00065430, 0x00065431, 0x00654310, 0x00065432, 0x00654320,
+        0x00654321, 0x06543210, 0x00000007, 0x00000070, 0x00000071, 0x00000710,
+        0x00000072, 0x00000720, 0x00000721, 0x00007210, 0x00000073, 0x00000730,
+        0x00000731, 0x00007310, 0x00000732, 0x00007320, 0x00007321, 0x00073210,
+        0x00000074, 0x00000740, 0x00000741, 0x00007410, 0x00000742, 0x00007420,
+        0x00007421, 0x00074210, 0x00000743, 0x00007430, 0x00007431, 0x00074310,
+        0x00007432, 0x00074320, 0x00074321, 0x00743210, 0x00000075, 0x00000750,
+        0x00000751, 0x00007510, 0x00000752, 0x00007520, 0x00007521, 0x00075210,
+        0x00000753, 0x00007530, 0x00007531, 0x00075310, 0x00007532, 0x00075320,
+        0x00075321, 0x00753210, 0x00000754, 0x00007540, 0x00007541, 0x00075410,
+        0x00007542, 0x00075420, 0x00075421, 0x00754210, 0x00007543, 0x00075430,
+        0x00075431, 0x00754310, 0x00075432, 0x00754320, 0x00754321, 0x07543210,
+        0x00000076, 0x00000760, 0x00000761, 0x00007610, 0x00000762, 0x00007620,
+        0x00007621, 0x00076210, 0x00000763, 0x00007630, 0x00007631, 0x00076310,
+        0x00007632, 0x00076320, 0x00076321, 0x00763210, 0x00000764, 0x00007640,
+        0x00007641, 0x00076410, 0x00007642, 0x00076420, 0x00076421, 0x00764210,
+        0x00007643, 0x00076430, 0x00076431, 0x00764310, 0x00076432, 0x00764320,
+        0x00764321, 0x07643210, 0x00000765, 0x00007650, 0x00007651, 0x00076510,
+        0x00007652, 0x00076520, 0x00076521, 0x00765210, 0x00007653, 0x00076530,
+        0x00076531, 0x00765310, 0x00076532, 0x00765320, 0x00765321, 0x07653210,
+        0x00007654, 0x00076540, 0x00076541, 0x00765410, 0x00076542, 0x00765420,
+        0x00765421, 0x07654210, 0x00076543, 0x00765430, 0x00765431, 0x07654310,
+        0x00765432, 0x07654320, 0x07654321, 0x76543210
+      };
+      return lut;
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> compress_loop(const pack<T, W> &p,
+                                          const mask<T, W> &m)
+    {
+      pack<T, W> result(T(0));
+      int n = 0;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          result[n++] = p[i];
+
+      return result;
+    }
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i compress_epi32(const __m128i &v, int bits)
+    {
+#if defined(__AVX512VL__)
+      return _mm_maskz_compress_epi32(__mmask8(bits), v);
+#else
+      const uint32_t lut = compress_lut()[bits];
+      const __m128i lane = _mm_setr_epi32(
+          lut & 0x3, (lut >> 4) & 0x3, (lut >> 8) & 0x3, (lut >> 12) & 0x3);
+      // 4 byte indices per lane: 4 * lane + {0, 1, 2, 3}
+      const __m128i bytes =
+          _mm_add_epi32(_mm_mullo_epi32(lane, _mm_set1_epi32(0x04040404)),
+                        _mm_set1_epi32(0x03020100));
+      const __m128i keep = _mm_cmpgt_epi32(_mm_set1_epi32(_mm_popcnt_u32(bits)),
+                                           _mm_setr_epi32(0, 1, 2, 3));
+      return _mm_and_si128(_mm_shuffle_epi8(v, bytes), keep);
+#endif
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i compress_epi32(const __m256i &v, int bits)
+    {
+      const __m256i lane = _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_set1_epi32(compress_lut()[bits]),
+                            _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+          _mm256_set1_epi32(0x7));
+      const __m256i keep =
+          _mm256_cmpgt_epi32(_mm256_set1_epi32(_mm_popcnt_u32(bits)),
+                             _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+      return _mm256_and_si256(_mm256_permutevar8x32_epi32(v, lane), keep);
+    }
+
+    TSIMD_INLINE __m256i compress_epi64(const __m256i &v, int bits)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_maskz_compress_epi64(__mmask8(bits), v);
+#else
+      // each 64-bit lane k moves as the 32-bit lanes {2k, 2k + 1}
+      const __m256i lane = _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_set1_epi32(compress_lut()[bits]),
+                            _mm256_setr_epi32(0, 0, 4, 4, 8, 8, 12, 12)),
+          _mm256_set1_epi32(0x3));
+      const __m256i lane32 =
+          _mm256_add_epi32(_mm256_add_epi32(lane, lane),
+                           _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+      const __m256i keep =
+          _mm256_cmpgt_epi64(_mm256_set1_epi64x(_mm_popcnt_u32(bits)),
+                             _mm256_setr_epi64x(0, 1, 2, 3));
+      return _mm256_and_si256(_mm256_permutevar8x32_epi32(v, lane32), keep);
+#endif
+    }
+#endif
+
+  }  // namespace detail
+
+  // compress() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Moves the active lanes of 'p' to the front of the result (in
+  //             order), and sets the remaining lanes to zero.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> compress(const pack<T, W> &p, const mask<T, W> &m)
+  {
+    return detail::compress_loop(p, m);
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 compress(const vfloat4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_ps(
+        detail::compress_epi32(_mm_castps_si128(p), _mm_movemask_ps(m)));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint4 compress(const vint4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return detail::compress_epi32(p, _mm_movemask_ps(m));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint4 compress(const vuint4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return detail::compress_epi32(p, _mm_movemask_ps(m));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 compress(const vdouble4 &p, const vboold4 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_castsi256_pd(
+        detail::compress_epi64(_mm256_castpd_si256(p), _mm256_movemask_pd(m)));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 compress(const vllong4 &p, const vboold4 &m)
+  {
+#if defined(__AVX2__)
+    return detail::compress_epi64(p, _mm256_movemask_pd(m));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 compress(const vfloat8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_compress_ps(m, p);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_ps(
+        detail::compress_epi32(_mm256_castps_si256(p), _mm256_movemask_ps(m)));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint8 compress(const vint8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_compress_epi32(m, p);
+#elif defined(__AVX2__)
+    return detail::compress_epi32(p, _mm256_movemask_ps(m));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint8 compress(const vuint8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_compress_epi32(m, p);
+#elif defined(__AVX2__)
+    return detail::compress_epi32(p, _mm256_movemask_ps(m));
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 compress(const vdouble8 &p, const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_compress_pd(m, p);
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 compress(const vllong8 &p, const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_compress_epi64(m, p);
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 compress(const vfloat16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_compress_ps(m, p);
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint16 compress(const vint16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_compress_epi32(m, p);
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint16 compress(const vuint16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_compress_epi32(m, p);
+#else
+    return detail::compress_loop(p, m);
+#endif
+  }
+
+  // compress_store() /////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Stores only the active lanes of 'p', contiguously starting at
+  //             '_dst' (which has no alignment requirement), and returns how
+  //             many were stored.
+
+  template <typename T, int W>
+  TSIMD_INLINE int compress_store(const pack<T, W> &p,
+                                  void *_dst,
+                                  const mask<T, W> &m)
+  {
+    auto *dst = (T *)_dst;
+    int n     = 0;
+
+    for (int i = 0; i < W; ++i)
+      if (m[i])
+        dst[n++] = p[i];
+
+    return n;
+  }
+
+#if defined(__AVX512F__)
+  TSIMD_INLINE int compress_store(const vdouble8 &p,
+                                  void *_dst,
+                                  const vboold8 &m)
+  {
+    _mm512_mask_compressstoreu_pd(_dst, m, p);
+    return _mm_popcnt_u32(m);
+  }
+
+  TSIMD_INLINE int compress_store(const vllong8 &p,
+                                  void *_dst,
+                                  const vboold8 &m)
+  {
+    _mm512_mask_compressstoreu_epi64(_dst, m, p);
+    return _mm_popcnt_u32(m);
+  }
+
+  TSIMD_INLINE int compress_store(const vfloat16 &p,
+                                  void *_dst,
+                                  const vboolf16 &m)
+  {
+    _mm512_mask_compressstoreu_ps(_dst, m, p);
+    return _mm_popcnt_u32(m);
+  }
+
+  TSIMD_INLINE int compress_store(const vint16 &p,
+                                  void *_dst,
+                                  const vboolf16 &m)
+  {
+    _mm512_mask_compressstoreu_epi32(_dst, m, p);
+    return _mm_popcnt_u32(m);
+  }
+
+  TSIMD_INLINE int compress_store(const vuint16 &p,
+                                  void *_dst,
+                                  const vboolf16 &m)
+  {
+    _mm512_mask_compressstoreu_epi32(_dst, m, p);
+    return _mm_popcnt_u32(m);
+  }
+#endif
+
+#if defined(__AVX2__)
+  // NOTE(jda) - Compress in registers, then only write the first 'n' lanes
+  //             with a masked store (which never touches the others).
+
+  TSIMD_INLINE int compress_store(const vfloat4 &p,
+                                  void *_dst,
+                                  const vboolf4 &m)
+  {
+    const int n          = _mm_popcnt_u32(_mm_movemask_ps(m));
+    const __m128i active =
+        _mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3));
+    _mm_maskstore_ps((float *)_dst, active, compress(p, m));
+    return n;
+  }
+
+  TSIMD_INLINE int compress_store(const vint4 &p,
+                                  void *_dst,
+                                  const vboolf4 &m)
+  {
+    return compress_store(vfloat4(_mm_castsi128_ps(p)), _dst, m);
+  }
+
+  TSIMD_INLINE int compress_store(const vuint4 &p,
+                                  void *_dst,
+                                  const vboolf4 &m)
+  {
+    return compress_store(vfloat4(_mm_castsi128_ps(p)), _dst, m);
+  }
+
+  TSIMD_INLINE int compress_store(const vfloat8 &p,
+                                  void *_dst,
+                                  const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    _mm256_mask_compressstoreu_ps(_dst, m, p);
+    return _mm_popcnt_u32(m);
+#else
+    const int n          = _mm_popcnt_u32(_mm256_movemask_ps(m));
+    const __m256i active = _mm256_cmpgt_epi32(
+        _mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    _mm256_maskstore_ps((float *)_dst, active, compress(p, m));
+    return n;
+#endif
+  }
+
+  TSIMD_INLINE int compress_store(const vint8 &p,
+                                  void *_dst,
+                                  const vboolf8 &m)
+  {
+    return compress_store(vfloat8(_mm256_castsi256_ps(p)), _dst, m);
+  }
+
+  TSIMD_INLINE int compress_store(const vuint8 &p,
+                                  void *_dst,
+                                  const vboolf8 &m)
+  {
+    return compress_store(vfloat8(_mm256_castsi256_ps(p)), _dst, m);
+  }
+
+  TSIMD_INLINE int compress_store(const vdouble4 &p,
+                                  void *_dst,
+                                  const vboold4 &m)
+  {
+    const int n          = _mm_popcnt_u32(_mm256_movemask_pd(m));
+    const __m256i active = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                                              _mm256_setr_epi64x(0, 1, 2, 3));
+    _mm256_maskstore_pd((double *)_dst, active, compress(p, m));
+    return n;
+  }
+
+  TSIMD_INLINE int compress_store(const vllong4 &p,
+                                  void *_dst,
+                                  const vboold4 &m)
+  {
+    return compress_store(vdouble4(_mm256_castsi256_pd(p)), _dst, m);
+  }
+#endif
+
+}  // namespace tsimd
@@ -0,0 +1,421 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    // NOTE(jda) - expand_lut()[m] holds, for each active lane i of the 8-bit
+    //             mask 'm', the number of active lanes below i (i.e. which
+    //             source element lane i receives) in nibble i. Inactive lanes
+    //             are 0. The 4-wide versions use the first 16 entries.
+    TSIMD_INLINE const uint32_t *expand_lut()
+    {
+      static const uint32_t lut[256] = {
+        0x00000000, 0x00000000, 0x00000000, 0x00000010, 0x00000000, 0x00000100,
+        0x00000100, 0x00000210, 0x00000000, 0x00001000, 0x00001000, 0x00002010,
+        0x00001000, 0x00002100, 0x00002100, 0x00003210, 0x00000000, 0x00010000,
+        0x00010000, 0x00020010, 0x00010000, 0x00020100, 0x00020100, 0x00030210,
+        0x00010000, 0x00021000, 0x00021000, 0x00032010, 0x00021000, 0x00032100,
+        0x00032100, 0x00043210, 0x00000000, 0x00100000, 0x00100000, 0x00200010,
+        0x00100000, 0x00200100, 0x00200100, 0x00300210, 0x00100000, 0x00201000,
+        0x00201000, 0x00302010, 0x00201000, 0x00302100, 0x00302100, 0x00403210,
+        0x00100000, 0x00210000, 0x00210000, 0x00320010, 0x00210000, 0x00320100,
+        0x00320100, 0x00430210, 0x00210000, 0x00321000, 0x00321000, 0x00432010,
+        0x00321000, 0x00432100, 0x00432100, 0x00543210, 0x00000000, 0x01000000,
+        0x01000000, 0x02000010, 0x01000000, 0x02000100, 0x02000100, 0x03000210,
+        0x01000000, 0x02001000, 0x02001000, 0x03002010, 0x02001000, 0x03002100,
+        0x03002100, 0x04003210, 0x01000000, 0x02010000, 0x02010000, 0x03020010,
+        0x02010000, 0x03020100, 0x03020100, 0x04030210, 0x02010000, 0x03021000,
+        0x03021000, 0x04032010, 0x03021000, 0x04032100, 0x04032100, 0x05043210,
+        0x01000000, 0x02100000, 0x02100000, 0x03200010, 0x02100000, 0x03200100,
+        0x03200100, 0x04300210, 0x02100000, 0x03201000, 0x03201000, 0x04302010,
+        0x03201000, 0x04302100, 0x04302100, 0x05403210, 0x02100000, 0x03210000,
+        0x03210000, 0x04320010, 0x03210000, 0x04320100, 0x04320100, 0x05430210,
+        0x03210000, 0x04321000, 0x04321000, 0x05432010, 0x04321000, 0x05432100,
+        0x05432100, 0x06543210, 0x00000000, 0x10000000, 0x10000000, 0x20000010,
+        0x10000000, 0x20000100, 0x20000100, 0x30000210, 0x10000000, 0x20001000,
+        0x20001000, 0x30002010, 0x20001000, 0x30002100, 0x30002100, 0x40003210,
+        0x10000000, 0x20010000, 0x20010000, 0x30020010, 0x20010000, 0x30020100,
+        0x30020100, 0x40030210, 0x20010000, 0x30021000, 0x30021000, 0x40032010,
+        0x30021000, 0x40032100, 0x40032100, 0x50043210, 0x10000000, 0x20100000,
+        0x20100000, 0x30200010, 0x20100000, 0x30200100, 0x30200100, 0x40300210,
+        0x20100000, 0x30201000, 0x30201000, 0x40302010, 0x30201000, 0x40302100,
+        0x40302100, 0x50403210, 0x20100000, 0x30210000, 0x30210000, 0x40320010,
+        0x30210000, 0x40320100, 0x40320100, 0x50430210, 0x30210000, 0x40321000,
+        0x40321000, 0x50432010, 0x40321000, 0x50432100, 0x50432100, 0x60543210,
+        0x10000000, 0x21000000, 0x21000000, 0x32000010, 0x21000000, 0x32000100,
+        0x32000100, 0x43000210, 0x21000000, 0x32001000, 0x32001000, 0x43002010,
+        0x32001000, 0x43002100, 0x43002100, 0x54003210, 0x21000000, 0x32010000,
+        0x32010000, 0x43020010, 0x32010000, 0x43020100, 0x43020100, 0x54030210,
+        0x32010000, 0x43021000, 0x43021000, 0x54032010, 0x43021000, 0x54032100,
+        0x54032100, 0x65043210, 0x21000000, 0x32100000, 0x32100000, 0x43200010,
+        0x32100000, 0x43200100, 0x43200100, 0x54300210, 0x32100000, 0x43201000,
+        0x43201000, 0x54302010, 0x43201000, 0x54302100, 0x54302100, 0x65403210,
+        0x32100000, 0x43210000, 0x43210000, 0x54320010, 0x43210000, 0x54320100,
+        0x54320100, 0x65430210, 0x43210000, 0x54321000, 0x54321000, 0x65432010,
+        0x54321000, 0x65432100, 0x65432100, 0x76543210
+      };
+      return lut;
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> expand_loop(const pack<T, W> &p,
+                                        const mask<T, W> &m)
+    {
+      pack<T, W> result(T(0));
+      int n = 0;
+
+      for (int i = 0; i < W; ++i)
+        if (m[i])
+          result[i] = p[n++];
+
+      return result;
+    }
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i expand_epi32(const __m128i &v, const __m128i &m)
+    {
+      const int bits = _mm_movemask_ps(_mm_castsi128_ps(m));
+#if defined(__AVX512VL__)
+      return _mm_maskz_expand_epi32(__mmask8(bits), v);
+#else
+      const uint32_t lut = expand_lut()[bits];
+      const __m128i lane = _mm_setr_epi32(
+          lut & 0x3, (lut >> 4) & 0x3, (lut >> 8) & 0x3, (lut >> 12) & 0x3);
+      // 4 byte indices per lane: 4 * lane + {0, 1, 2, 3}
+      const __m128i bytes =
+          _mm_add_epi32(_mm_mullo_epi32(lane, _mm_set1_epi32(0x04040404)),
+                        _mm_set1_epi32(0x03020100));
+      return _mm_and_si128(_mm_shuffle_epi8(v, bytes), m);
+#endif
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i expand_epi32(const __m256i &v, const __m256i &m)
+    {
+      const int bits = _mm256_movemask_ps(_mm256_castsi256_ps(m));
+      const __m256i lane = _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_set1_epi32(expand_lut()[bits]),
+                            _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+          _mm256_set1_epi32(0x7));
+      return _mm256_and_si256(_mm256_permutevar8x32_epi32(v, lane), m);
+    }
+
+    TSIMD_INLINE __m256i expand_epi64(const __m256i &v, const __m256i &m)
+    {
+      const int bits = _mm256_movemask_pd(_mm256_castsi256_pd(m));
+#if defined(__AVX512VL__)
+      return _mm256_maskz_expand_epi64(__mmask8(bits), v);
+#else
+      // each 64-bit lane k moves as the 32-bit lanes {2k, 2k + 1}
+      const __m256i lane = _mm256_and_si256(
+          _mm256_srlv_epi32(_mm256_set1_epi32(expand_lut()[bits]),
+                            _mm256_setr_epi32(0, 0, 4, 4, 8, 8, 12, 12)),
+          _mm256_set1_epi32(0x3));
+      const __m256i lane32 =
+          _mm256_add_epi32(_mm256_add_epi32(lane, lane),
+                           _mm256_setr_epi32(0, 1, 0, 1, 0, 1, 0, 1));
+      return _mm256_and_si256(_mm256_permutevar8x32_epi32(v, lane32), m);
+#endif
+    }
+#endif
+
+  }  // namespace detail
+
+  // expand() /////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - The inverse of compress(): the first elements of 'p' are
+  //             moved (in order) to the active lanes of the result, and the
+  //             inactive lanes are set to zero.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> expand(const pack<T, W> &p, const mask<T, W> &m)
+  {
+    return detail::expand_loop(p, m);
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 expand(const vfloat4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_ps(
+        detail::expand_epi32(_mm_castps_si128(p), _mm_castps_si128(m)));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint4 expand(const vint4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return detail::expand_epi32(p, _mm_castps_si128(m));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint4 expand(const vuint4 &p, const vboolf4 &m)
+  {
+#if defined(__SSE4_2__)
+    return detail::expand_epi32(p, _mm_castps_si128(m));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 expand(const vdouble4 &p, const vboold4 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_castsi256_pd(
+        detail::expand_epi64(_mm256_castpd_si256(p), _mm256_castpd_si256(m)));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 expand(const vllong4 &p, const vboold4 &m)
+  {
+#if defined(__AVX2__)
+    return detail::expand_epi64(p, _mm256_castpd_si256(m));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 expand(const vfloat8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_expand_ps(m, p);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_ps(
+        detail::expand_epi32(_mm256_castps_si256(p), _mm256_castps_si256(m)));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint8 expand(const vint8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_expand_epi32(m, p);
+#elif defined(__AVX2__)
+    return detail::expand_epi32(p, _mm256_castps_si256(m));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint8 expand(const vuint8 &p, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_expand_epi32(m, p);
+#elif defined(__AVX2__)
+    return detail::expand_epi32(p, _mm256_castps_si256(m));
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vdouble8 expand(const vdouble8 &p, const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_expand_pd(m, p);
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 expand(const vllong8 &p, const vboold8 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_expand_epi64(m, p);
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 expand(const vfloat16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_expand_ps(m, p);
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vint16 expand(const vint16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_expand_epi32(m, p);
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  TSIMD_INLINE vuint16 expand(const vuint16 &p, const vboolf16 &m)
+  {
+#if defined(__AVX512F__)
+    return _mm512_maskz_expand_epi32(m, p);
+#else
+    return detail::expand_loop(p, m);
+#endif
+  }
+
+  // expand_load<>() //////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Reads as many consecutive elements from '_src' as there are
+  //             active lanes in 'm' (without touching the memory after them,
+  //             and without any alignment requirement), and puts them in the
+  //             active lanes of the result. Inactive lanes are set to zero.
+
+  template <typename PACK_T>
+  TSIMD_INLINE PACK_T
+  expand_load(const void *_src,
+              const mask<typename PACK_T::element_t, PACK_T::static_size> &m)
+  {
+    using T   = typename PACK_T::element_t;
+    auto *src = (const T *)_src;
+    PACK_T result(T(0));
+    int n = 0;
+
+    for (int i = 0; i < PACK_T::static_size; ++i)
+      if (m[i])
+        result[i] = src[n++];
+
+    return result;
+  }
+
+#if defined(__AVX512F__)
+  template <>
+  TSIMD_INLINE vdouble8 expand_load(const void *_src, const vboold8 &m)
+  {
+    return _mm512_maskz_expandloadu_pd(m, _src);
+  }
+
+  template <>
+  TSIMD_INLINE vllong8 expand_load(const void *_src, const vboold8 &m)
+  {
+    return _mm512_maskz_expandloadu_epi64(m, _src);
+  }
+
+  template <>
+  TSIMD_INLINE vfloat16 expand_load(const void *_src, const vboolf16 &m)
+  {
+    return _mm512_maskz_expandloadu_ps(m, _src);
+  }
+
+  template <>
+  TSIMD_INLINE vint16 expand_load(const void *_src, const vboolf16 &m)
+  {
+    return _mm512_maskz_expandloadu_epi32(m, _src);
+  }
+
+  template <>
+  TSIMD_INLINE vuint16 expand_load(const void *_src, const vboolf16 &m)
+  {
+    return _mm512_maskz_expandloadu_epi32(m, _src);
+  }
+#endif
+
+#if defined(__AVX2__)
+  // NOTE(jda) - Only read the first 'n' elements with a masked load (which
+  //             never faults on the others), then expand in registers.
+
+  template <>
+  TSIMD_INLINE vfloat4 expand_load(const void *_src, const vboolf4 &m)
+  {
+    const int n          = _mm_popcnt_u32(_mm_movemask_ps(m));
+    const __m128i active =
+        _mm_cmpgt_epi32(_mm_set1_epi32(n), _mm_setr_epi32(0, 1, 2, 3));
+    return expand(vfloat4(_mm_maskload_ps((const float *)_src, active)), m);
+  }
+
+  template <>
+  TSIMD_INLINE vint4 expand_load(const void *_src, const vboolf4 &m)
+  {
+    return _mm_castps_si128(expand_load<vfloat4>(_src, m));
+  }
+
+  template <>
+  TSIMD_INLINE vuint4 expand_load(const void *_src, const vboolf4 &m)
+  {
+    return _mm_castps_si128(expand_load<vfloat4>(_src, m));
+  }
+
+  template <>
+  TSIMD_INLINE vfloat8 expand_load(const void *_src, const vboolf8 &m)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_maskz_expandloadu_ps(m, _src);
+#else
+    const int n          = _mm_popcnt_u32(_mm256_movemask_ps(m));
+    const __m256i active = _mm256_cmpgt_epi32(
+        _mm256_set1_epi32(n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    return expand(vfloat8(_mm256_maskload_ps((const float *)_src, active)), m);
+#endif
+  }
+
+  template <>
+  TSIMD_INLINE vint8 expand_load(const void *_src, const vboolf8 &m)
+  {
+    return _mm256_castps_si256(expand_load<vfloat8>(_src, m));
+  }
+
+  template <>
+  TSIMD_INLINE vuint8 expand_load(const void *_src, const vboolf8 &m)
+  {
+    return _mm256_castps_si256(expand_load<vfloat8>(_src, m));
+  }
+
+  template <>
+  TSIMD_INLINE vdouble4 expand_load(const void *_src, const vboold4 &m)
+  {
+    const int n          = _mm_popcnt_u32(_mm256_movemask_pd(m));
+    const __m256i active = _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                                              _mm256_setr_epi64x(0, 1, 2, 3));
+    return expand(vdouble4(_mm256_maskload_pd((const double *)_src, active)),
+                  m);
+  }
+
+  template <>
+  TSIMD_INLINE vllong4 expand_load(const void *_src, const vboold4 &m)
+  {
+    return _mm256_castpd_si256(expand_load<vdouble4>(_src, m));
+  }
+#endif
+
+}  // namespace tsimd
@@ -0,0 +1,190 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "permute.h"
+
+namespace tsimd {
+
+  // interleave_lo()/interleave_hi() //////////////////////////////////////////
+
+  // NOTE(jda) - Interleaving 'a' and 'b' gives {a0, b0, a1, b1, ...}, which is
+  //             2W elements long: interleave_lo() returns the first W of them
+  //             and interleave_hi() the last W.
+
+  namespace detail {
+
+    template <int HALF, typename T, int W>
+    TSIMD_INLINE pack<T, W> interleave_impl(const pack<T, W> &a,
+                                            const pack<T, W> &b)
+    {
+      pack<int, W> idx;
+
+      for (int i = 0; i < W; ++i) {
+        const int k = i + HALF * W;
+        idx[i]      = k / 2 + (k & 1) * W;
+      }
+
+      return permute2(a, b, idx);
+    }
+
+  }  // namespace detail
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> interleave_lo(const pack<T, W> &a,
+                                        const pack<T, W> &b)
+  {
+    return detail::interleave_impl<0>(a, b);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> interleave_hi(const pack<T, W> &a,
+                                        const pack<T, W> &b)
+  {
+    return detail::interleave_impl<1>(a, b);
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 interleave_lo(const vfloat4 &a, const vfloat4 &b)
+  {
+#if defined(__SSE4_2__)
+    return _mm_unpacklo_ps(a, b);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vfloat4 interleave_hi(const vfloat4 &a, const vfloat4 &b)
+  {
+#if defined(__SSE4_2__)
+    return _mm_unpackhi_ps(a, b);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vint4 interleave_lo(const vint4 &a, const vint4 &b)
+  {
+#if defined(__SSE4_2__)
+    return _mm_unpacklo_epi32(a, b);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vint4 interleave_hi(const vint4 &a, const vint4 &b)
+  {
+#if defined(__SSE4_2__)
+    return _mm_unpackhi_epi32(a, b);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 interleave_lo(const vdouble4 &a, const vdouble4 &b)
+  {
+#if defined(__AVX__)
+    return _mm256_permute2f128_pd(
+        _mm256_unpacklo_pd(a, b), _mm256_unpackhi_pd(a, b), 0x20);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vdouble4 interleave_hi(const vdouble4 &a, const vdouble4 &b)
+  {
+#if defined(__AVX__)
+    return _mm256_permute2f128_pd(
+        _mm256_unpacklo_pd(a, b), _mm256_unpackhi_pd(a, b), 0x31);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 interleave_lo(const vllong4 &a, const vllong4 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute2x128_si256(
+        _mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b), 0x20);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 interleave_hi(const vllong4 &a, const vllong4 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute2x128_si256(
+        _mm256_unpacklo_epi64(a, b), _mm256_unpackhi_epi64(a, b), 0x31);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 interleave_lo(const vfloat8 &a, const vfloat8 &b)
+  {
+#if defined(__AVX__)
+    return _mm256_permute2f128_ps(
+        _mm256_unpacklo_ps(a, b), _mm256_unpackhi_ps(a, b), 0x20);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vfloat8 interleave_hi(const vfloat8 &a, const vfloat8 &b)
+  {
+#if defined(__AVX__)
+    return _mm256_permute2f128_ps(
+        _mm256_unpacklo_ps(a, b), _mm256_unpackhi_ps(a, b), 0x31);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vint8 interleave_lo(const vint8 &a, const vint8 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute2x128_si256(
+        _mm256_unpacklo_epi32(a, b), _mm256_unpackhi_epi32(a, b), 0x20);
+#else
+    return detail::interleave_impl<0>(a, b);
+#endif
+  }
+
+  TSIMD_INLINE vint8 interleave_hi(const vint8 &a, const vint8 &b)
+  {
+#if defined(__AVX2__)
+    return _mm256_permute2x128_si256(
+        _mm256_unpacklo_epi32(a, b), _mm256_unpackhi_epi32(a, b), 0x31);
+#else
+    return detail::interleave_impl<1>(a, b);
+#endif
+  }
+
+}  // namespace tsimd
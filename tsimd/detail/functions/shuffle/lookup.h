@@ -0,0 +1,114 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // lookup() /////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Returns table[indices[i]] in each lane, where 'table' holds
+  //             16 byte-sized entries (i.e. pshufb). Indices outside of
+  //             [0, 16) produce 0: a saturating add of 0x70 keeps the low
+  //             nibble of valid indices and sets the high bit of the rest.
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> lookup(const pack<T, 16> &table,
+                                 const pack<uint8_t, W> &indices)
+  {
+    static_assert(sizeof(T) == 1, "lookup() requires 8-bit elements!");
+
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = indices[i] < 16 ? table[indices[i]] : T(0);
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 lookup(const vchar16 &table, const vuchar16 &indices)
+  {
+    const __m128i idx = _mm_adds_epu8(indices, _mm_set1_epi8(0x70));
+    return _mm_shuffle_epi8(table, idx);
+  }
+
+  TSIMD_INLINE vuchar16 lookup(const vuchar16 &table, const vuchar16 &indices)
+  {
+    const __m128i idx = _mm_adds_epu8(indices, _mm_set1_epi8(0x70));
+    return _mm_shuffle_epi8(table, idx);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 lookup(const vchar16 &table, const vuchar32 &indices)
+  {
+#if defined(__AVX2__)
+    const __m256i lut = _mm256_broadcastsi128_si256(table);
+    const __m256i idx = _mm256_adds_epu8(indices, _mm256_set1_epi8(0x70));
+    return _mm256_shuffle_epi8(lut, idx);
+#else
+    return vchar32(lookup(table, vuchar16(indices.vl)),
+                   lookup(table, vuchar16(indices.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 lookup(const vuchar16 &table, const vuchar32 &indices)
+  {
+#if defined(__AVX2__)
+    const __m256i lut = _mm256_broadcastsi128_si256(table);
+    const __m256i idx = _mm256_adds_epu8(indices, _mm256_set1_epi8(0x70));
+    return _mm256_shuffle_epi8(lut, idx);
+#else
+    return vuchar32(lookup(table, vuchar16(indices.vl)),
+                    lookup(table, vuchar16(indices.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 lookup(const vchar16 &table, const vuchar64 &indices)
+  {
+#if defined(__AVX512BW__)
+    const __m512i lut = _mm512_broadcast_i32x4(table);
+    const __m512i idx = _mm512_adds_epu8(indices, _mm512_set1_epi8(0x70));
+    return _mm512_shuffle_epi8(lut, idx);
+#else
+    return vchar64(lookup(table, vuchar32(indices.vl)),
+                   lookup(table, vuchar32(indices.vh)));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 lookup(const vuchar16 &table, const vuchar64 &indices)
+  {
+#if defined(__AVX512BW__)
+    const __m512i lut = _mm512_broadcast_i32x4(table);
+    const __m512i idx = _mm512_adds_epu8(indices, _mm512_set1_epi8(0x70));
+    return _mm512_shuffle_epi8(lut, idx);
+#else
+    return vuchar64(lookup(table, vuchar32(indices.vl)),
+                    lookup(table, vuchar32(indices.vh)));
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,446 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+
+namespace tsimd {
+
+  // permute() ////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Returns a pack where lane 'i' is p[idx[i]]. Only the low
+  //             log2(W) bits of each index are used, like the hardware
+  //             permute instructions.
+
+  namespace detail {
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute_loop(const pack<T, W> &p,
+                                         const pack<int, W> &idx)
+    {
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i)
+        result[i] = p[idx[i] & (W - 1)];
+
+      return result;
+    }
+
+    template <typename T, int W>
+    TSIMD_INLINE pack<T, W> permute2_loop(const pack<T, W> &a,
+                                          const pack<T, W> &b,
+                                          const pack<int, W> &idx)
+    {
+      pack<T, W> result;
+
+      for (int i = 0; i < W; ++i) {
+        const int j = idx[i] & (2 * W - 1);
+        result[i]   = j < W ? a[j] : b[j - W];
+      }
+
+      return result;
+    }
+
+#if defined(__SSE4_2__)
+    // pshufb control which moves whole 32-bit lanes
+    TSIMD_INLINE __m128i permute_ctrl_epi32(const __m128i idx)
+    {
+      const __m128i lanes = _mm_and_si128(idx, _mm_set1_epi32(3));
+      const __m128i bytes = _mm_shuffle_epi8(
+          _mm_slli_epi32(lanes, 2),
+          _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+      return _mm_add_epi8(bytes, _mm_set1_epi32(0x03020100));
+    }
+#endif
+
+#if defined(__AVX2__)
+    // vpermd control which moves whole 64-bit lanes
+    TSIMD_INLINE __m256i permute_ctrl_epi64(const __m128i idx)
+    {
+      const __m256i lo = _mm256_slli_epi64(
+          _mm256_cvtepi32_epi64(_mm_and_si128(idx, _mm_set1_epi32(3))), 1);
+      const __m256i hi = _mm256_add_epi64(lo, _mm256_set1_epi64x(1));
+      return _mm256_or_si256(lo, _mm256_slli_epi64(hi, 32));
+    }
+#endif
+
+  }  // namespace detail
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE pack<T, 1> permute(const pack<T, 1> &p, const vint1 &)
+  {
+    return p;
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 permute(const vfloat4 &p, const vint4 &idx)
+  {
+#if defined(__AVX__)
+    return _mm_permutevar_ps(p, idx);
+#elif defined(__SSE4_2__)
+    return _mm_castsi128_ps(_mm_shuffle_epi8(
+        _mm_castps_si128(p), detail::permute_ctrl_epi32(idx)));
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint4 permute(const vint4 &p, const vint4 &idx)
+  {
+#if defined(__AVX__)
+    return _mm_castps_si128(_mm_permutevar_ps(_mm_castsi128_ps(p), idx));
+#elif defined(__SSE4_2__)
+    return _mm_shuffle_epi8(p, detail::permute_ctrl_epi32(idx));
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint4 permute(const vuint4 &p, const vint4 &idx)
+  {
+    return vuint4(permute(vint4(p), idx));
+  }
+
+  TSIMD_INLINE vdouble4 permute(const vdouble4 &p, const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutexvar_pd(_mm256_cvtepi32_epi64(idx), p);
+#elif defined(__AVX2__)
+    return _mm256_castps_pd(_mm256_permutevar8x32_ps(
+        _mm256_castpd_ps(p), detail::permute_ctrl_epi64(idx)));
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 permute(const vllong4 &p, const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutexvar_epi64(_mm256_cvtepi32_epi64(idx), p);
+#elif defined(__AVX2__)
+    return _mm256_permutevar8x32_epi32(p, detail::permute_ctrl_epi64(idx));
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 permute(const vfloat8 &p, const vint8 &idx)
+  {
+#if defined(__AVX2__)
+    return _mm256_permutevar8x32_ps(p, idx);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint8 permute(const vint8 &p, const vint8 &idx)
+  {
+#if defined(__AVX2__)
+    return _mm256_permutevar8x32_epi32(p, idx);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint8 permute(const vuint8 &p, const vint8 &idx)
+  {
+    return vuint8(permute(vint8(p), idx));
+  }
+
+  TSIMD_INLINE vdouble8 permute(const vdouble8 &p, const vint8 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutexvar_pd(_mm512_cvtepi32_epi64(idx), p);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 permute(const vllong8 &p, const vint8 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutexvar_epi64(_mm512_cvtepi32_epi64(idx), p);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 permute(const vfloat16 &p, const vint16 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutexvar_ps(idx, p);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint16 permute(const vint16 &p, const vint16 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutexvar_epi32(idx, p);
+#else
+    return detail::permute_loop(p, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint16 permute(const vuint16 &p, const vint16 &idx)
+  {
+    return vuint16(permute(vint16(p), idx));
+  }
+
+  TSIMD_INLINE vdouble16 permute(const vdouble16 &p, const vint16 &idx)
+  {
+    return detail::permute_loop(p, idx);
+  }
+
+  TSIMD_INLINE vllong16 permute(const vllong16 &p, const vint16 &idx)
+  {
+    return detail::permute_loop(p, idx);
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  // NOTE(jda) - Each half of the result picks from both halves of 'p', which
+  //             is exactly a permute2() of the halves (the index bits match).
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> permute(
+      const pack<T, W> &p, const pack<int, W> &idx)
+  {
+    using half_t     = pack<T, W / 2>;
+    using half_idx_t = pack<int, W / 2>;
+    const half_t lo(p.vl);
+    const half_t hi(p.vh);
+    return pack<T, W>(permute2(lo, hi, half_idx_t(idx.vl)),
+                      permute2(lo, hi, half_idx_t(idx.vh)));
+  }
+
+  // permute2() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Two source version of permute(): indices [0, W) select from
+  //             'a' and [W, 2W) select from 'b'.
+
+  // 1-wide //
+
+  template <typename T>
+  TSIMD_INLINE pack<T, 1> permute2(const pack<T, 1> &a,
+                                   const pack<T, 1> &b,
+                                   const vint1 &idx)
+  {
+    return (idx[0] & 1) ? b : a;
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 permute2(const vfloat4 &a,
+                                const vfloat4 &b,
+                                const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm_permutex2var_ps(a, idx, b);
+#elif defined(__SSE4_2__)
+    return _mm_blendv_ps(permute(a, idx),
+                         permute(b, idx),
+                         _mm_castsi128_ps(_mm_slli_epi32(idx, 29)));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint4 permute2(const vint4 &a, const vint4 &b, const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm_permutex2var_epi32(a, idx, b);
+#elif defined(__SSE4_2__)
+    return _mm_castps_si128(
+        _mm_blendv_ps(_mm_castsi128_ps(permute(a, idx)),
+                      _mm_castsi128_ps(permute(b, idx)),
+                      _mm_castsi128_ps(_mm_slli_epi32(idx, 29))));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint4 permute2(const vuint4 &a,
+                                const vuint4 &b,
+                                const vint4 &idx)
+  {
+    return vuint4(permute2(vint4(a), vint4(b), idx));
+  }
+
+  TSIMD_INLINE vdouble4 permute2(const vdouble4 &a,
+                                 const vdouble4 &b,
+                                 const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutex2var_pd(a, _mm256_cvtepi32_epi64(idx), b);
+#elif defined(__AVX2__)
+    const __m256i select_b = _mm256_slli_epi64(_mm256_cvtepi32_epi64(idx), 61);
+    return _mm256_blendv_pd(
+        permute(a, idx), permute(b, idx), _mm256_castsi256_pd(select_b));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 permute2(const vllong4 &a,
+                                const vllong4 &b,
+                                const vint4 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutex2var_epi64(a, _mm256_cvtepi32_epi64(idx), b);
+#elif defined(__AVX2__)
+    const __m256i select_b = _mm256_slli_epi64(_mm256_cvtepi32_epi64(idx), 61);
+    return _mm256_castpd_si256(
+        _mm256_blendv_pd(_mm256_castsi256_pd(permute(a, idx)),
+                         _mm256_castsi256_pd(permute(b, idx)),
+                         _mm256_castsi256_pd(select_b)));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 permute2(const vfloat8 &a,
+                                const vfloat8 &b,
+                                const vint8 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutex2var_ps(a, idx, b);
+#elif defined(__AVX2__)
+    return _mm256_blendv_ps(permute(a, idx),
+                            permute(b, idx),
+                            _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28)));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint8 permute2(const vint8 &a, const vint8 &b, const vint8 &idx)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_permutex2var_epi32(a, idx, b);
+#elif defined(__AVX2__)
+    return _mm256_castps_si256(
+        _mm256_blendv_ps(_mm256_castsi256_ps(permute(a, idx)),
+                         _mm256_castsi256_ps(permute(b, idx)),
+                         _mm256_castsi256_ps(_mm256_slli_epi32(idx, 28))));
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint8 permute2(const vuint8 &a,
+                                const vuint8 &b,
+                                const vint8 &idx)
+  {
+    return vuint8(permute2(vint8(a), vint8(b), idx));
+  }
+
+  TSIMD_INLINE vdouble8 permute2(const vdouble8 &a,
+                                 const vdouble8 &b,
+                                 const vint8 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutex2var_pd(a, _mm512_cvtepi32_epi64(idx), b);
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 permute2(const vllong8 &a,
+                                const vllong8 &b,
+                                const vint8 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutex2var_epi64(a, _mm512_cvtepi32_epi64(idx), b);
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vfloat16 permute2(const vfloat16 &a,
+                                 const vfloat16 &b,
+                                 const vint16 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutex2var_ps(a, idx, b);
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vint16 permute2(const vint16 &a,
+                               const vint16 &b,
+                               const vint16 &idx)
+  {
+#if defined(__AVX512F__)
+    return _mm512_permutex2var_epi32(a, idx, b);
+#else
+    return detail::permute2_loop(a, b, idx);
+#endif
+  }
+
+  TSIMD_INLINE vuint16 permute2(const vuint16 &a,
+                                 const vuint16 &b,
+                                 const vint16 &idx)
+  {
+    return vuint16(permute2(vint16(a), vint16(b), idx));
+  }
+
+  TSIMD_INLINE vdouble16 permute2(const vdouble16 &a,
+                                  const vdouble16 &b,
+                                  const vint16 &idx)
+  {
+    return detail::permute2_loop(a, b, idx);
+  }
+
+  TSIMD_INLINE vllong16 permute2(const vllong16 &a,
+                                 const vllong16 &b,
+                                 const vint16 &idx)
+  {
+    return detail::permute2_loop(a, b, idx);
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> permute2(
+      const pack<T, W> &a, const pack<T, W> &b, const pack<int, W> &idx)
+  {
+    return detail::permute2_loop(a, b, idx);
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,88 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "shuffle.h"
+
+namespace tsimd {
+
+  // reverse() ////////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Returns a pack with the lanes of 'p' in reverse order.
+
+  template <typename T, int W>
+  TSIMD_INLINE pack<T, W> reverse(const pack<T, W> &p)
+  {
+    pack<int, W> idx;
+
+    for (int i = 0; i < W; ++i)
+      idx[i] = W - 1 - i;
+
+    return permute(p, idx);
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vfloat4 reverse(const vfloat4 &p)
+  {
+    return shuffle<3, 2, 1, 0>(p);
+  }
+
+  TSIMD_INLINE vint4 reverse(const vint4 &p)
+  {
+    return shuffle<3, 2, 1, 0>(p);
+  }
+
+  TSIMD_INLINE vdouble4 reverse(const vdouble4 &p)
+  {
+#if defined(__AVX2__)
+    return shuffle<3, 2, 1, 0>(p);
+#elif defined(__AVX__)
+    const __m256d t = _mm256_permute_pd(p, 0x5);
+    return _mm256_permute2f128_pd(t, t, 0x1);
+#else
+    return vdouble4(p[3], p[2], p[1], p[0]);
+#endif
+  }
+
+  TSIMD_INLINE vllong4 reverse(const vllong4 &p)
+  {
+    return shuffle<3, 2, 1, 0>(p);
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vfloat8 reverse(const vfloat8 &p)
+  {
+#if defined(__AVX__)
+    const __m256 t = _mm256_permute_ps(p, _MM_SHUFFLE(0, 1, 2, 3));
+    return _mm256_permute2f128_ps(t, t, 0x1);
+#else
+    return vfloat8(p[7], p[6], p[5], p[4], p[3], p[2], p[1], p[0]);
+#endif
+  }
+
+}  // namespace tsimd
@@ -0,0 +1,154 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "shuffle.h"
+
+namespace tsimd {
+
+  // rotate<>() ///////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Rotates lanes towards index 0: lane 'i' of the result is
+  //             p[(i + N) % W]. Negative values of N rotate the other way.
+
+  namespace detail {
+
+    template <int N, typename T, int W>
+    TSIMD_INLINE pack<T, W> rotate_impl(const pack<T, W> &p)
+    {
+      pack<int, W> idx;
+
+      for (int i = 0; i < W; ++i)
+        idx[i] = (i + N) & (W - 1);
+
+      return permute(p, idx);
+    }
+
+    template <int N>
+    TSIMD_INLINE vfloat4 rotate_impl(const vfloat4 &p)
+    {
+#if defined(__SSE4_2__)
+      const __m128i v = _mm_castps_si128(p);
+      return _mm_castsi128_ps(_mm_alignr_epi8(v, v, 4 * (N & 3)));
+#else
+      return rotate_impl<N, float, 4>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vint4 rotate_impl(const vint4 &p)
+    {
+#if defined(__SSE4_2__)
+      return _mm_alignr_epi8(p, p, 4 * (N & 3));
+#else
+      return rotate_impl<N, int, 4>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vdouble4 rotate_impl(const vdouble4 &p)
+    {
+      return shuffle<N & 3, (N + 1) & 3, (N + 2) & 3, (N + 3) & 3>(p);
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong4 rotate_impl(const vllong4 &p)
+    {
+      return shuffle<N & 3, (N + 1) & 3, (N + 2) & 3, (N + 3) & 3>(p);
+    }
+
+    template <int N>
+    TSIMD_INLINE vfloat8 rotate_impl(const vfloat8 &p)
+    {
+#if defined(__AVX512VL__)
+      const __m256i v = _mm256_castps_si256(p);
+      return _mm256_castsi256_ps(_mm256_alignr_epi32(v, v, N & 7));
+#else
+      return rotate_impl<N, float, 8>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vint8 rotate_impl(const vint8 &p)
+    {
+#if defined(__AVX512VL__)
+      return _mm256_alignr_epi32(p, p, N & 7);
+#else
+      return rotate_impl<N, int, 8>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vdouble8 rotate_impl(const vdouble8 &p)
+    {
+#if defined(__AVX512F__)
+      const __m512i v = _mm512_castpd_si512(p);
+      return _mm512_castsi512_pd(_mm512_alignr_epi64(v, v, N & 7));
+#else
+      return rotate_impl<N, double, 8>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vllong8 rotate_impl(const vllong8 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_alignr_epi64(p, p, N & 7);
+#else
+      return rotate_impl<N, long long, 8>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vfloat16 rotate_impl(const vfloat16 &p)
+    {
+#if defined(__AVX512F__)
+      const __m512i v = _mm512_castps_si512(p);
+      return _mm512_castsi512_ps(_mm512_alignr_epi32(v, v, N & 15));
+#else
+      return rotate_impl<N, float, 16>(p);
+#endif
+    }
+
+    template <int N>
+    TSIMD_INLINE vint16 rotate_impl(const vint16 &p)
+    {
+#if defined(__AVX512F__)
+      return _mm512_alignr_epi32(p, p, N & 15);
+#else
+      return rotate_impl<N, int, 16>(p);
+#endif
+    }
+
+  }  // namespace detail
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> rotate(const pack<T, W> &p)
+  {
+    return detail::rotate_impl<N>(p);
+  }
+
+}  // namespace tsimd
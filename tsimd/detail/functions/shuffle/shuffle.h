@@ -0,0 +1,156 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "../../pack.h"
+#include "permute.h"
+
+namespace tsimd {
+
+  // shuffle<>() //////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Compile-time version of permute(): shuffle<I...>(p) returns a
+  //             pack where lane 'i' is p[I_i]. Patterns which fit a shuffle
+  //             immediate use one, everything else becomes a permute() with a
+  //             constant index vector.
+
+  namespace detail {
+
+    template <int... I, typename T, int W>
+    TSIMD_INLINE pack<T, W> shuffle_impl(const pack<T, W> &p)
+    {
+      return permute(p, pack<int, W>(std::array<int, W>{{I...}}));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vfloat4 shuffle_impl(const vfloat4 &p)
+    {
+#if defined(__SSE4_2__)
+      return _mm_shuffle_ps(p, p, _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+#else
+      return permute(p, vint4(I0, I1, I2, I3));
+#endif
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vint4 shuffle_impl(const vint4 &p)
+    {
+#if defined(__SSE4_2__)
+      return _mm_shuffle_epi32(p, _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+#else
+      return permute(p, vint4(I0, I1, I2, I3));
+#endif
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vdouble4 shuffle_impl(const vdouble4 &p)
+    {
+#if defined(__AVX2__)
+      return _mm256_permute4x64_pd(
+          p, _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+#else
+      return permute(p, vint4(I0, I1, I2, I3));
+#endif
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vllong4 shuffle_impl(const vllong4 &p)
+    {
+#if defined(__AVX2__)
+      return _mm256_permute4x64_epi64(
+          p, _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+#else
+      return permute(p, vint4(I0, I1, I2, I3));
+#endif
+    }
+
+    template <int I0, int I1, int I2, int I3, int I4, int I5, int I6, int I7>
+    TSIMD_INLINE vfloat8 shuffle_impl(const vfloat8 &p)
+    {
+#if defined(__AVX__)
+      // same pattern in both 128-bit halves -> vpermilps immediate
+      const bool in_lane = (I0 & 7) < 4 && (I1 & 7) < 4 && (I2 & 7) < 4 &&
+                           (I3 & 7) < 4 && (I4 & 7) == (I0 & 7) + 4 &&
+                           (I5 & 7) == (I1 & 7) + 4 &&
+                           (I6 & 7) == (I2 & 7) + 4 &&
+                           (I7 & 7) == (I3 & 7) + 4;
+      if (in_lane) {
+        return _mm256_permute_ps(p,
+                                 _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+      }
+#endif
+      return permute(p, vint8(I0, I1, I2, I3, I4, I5, I6, I7));
+    }
+
+  }  // namespace detail
+
+  template <int... I, typename T, int W>
+  TSIMD_INLINE pack<T, W> shuffle(const pack<T, W> &p)
+  {
+    static_assert(sizeof...(I) == W,
+                  "shuffle<>() requires one index per pack lane!");
+    return detail::shuffle_impl<I...>(p);
+  }
+
+  // shuffle2<>() /////////////////////////////////////////////////////////////
+
+  // NOTE(jda) - Compile-time version of permute2(): indices [0, W) select
+  //             from 'a' and [W, 2W) select from 'b'.
+
+  namespace detail {
+
+    template <int... I, typename T, int W>
+    TSIMD_INLINE pack<T, W> shuffle2_impl(const pack<T, W> &a,
+                                          const pack<T, W> &b)
+    {
+      return permute2(a, b, pack<int, W>(std::array<int, W>{{I...}}));
+    }
+
+    template <int I0, int I1, int I2, int I3>
+    TSIMD_INLINE vfloat4 shuffle2_impl(const vfloat4 &a, const vfloat4 &b)
+    {
+#if defined(__SSE4_2__)
+      // low half from 'a' and high half from 'b' -> shufps immediate
+      const bool fits_shufps =
+          (I0 & 7) < 4 && (I1 & 7) < 4 && (I2 & 7) >= 4 && (I3 & 7) >= 4;
+      if (fits_shufps) {
+        return _mm_shuffle_ps(
+            a, b, _MM_SHUFFLE(I3 & 3, I2 & 3, I1 & 3, I0 & 3));
+      }
+#endif
+      return permute2(a, b, vint4(I0, I1, I2, I3));
+    }
+
+  }  // namespace detail
+
+  template <int... I, typename T, int W>
+  TSIMD_INLINE pack<T, W> shuffle2(const pack<T, W> &a, const pack<T, W> &b)
+  {
+    static_assert(sizeof...(I) == W,
+                  "shuffle2<>() requires one index per pack lane!");
+    return detail::shuffle2_impl<I...>(a, b);
+  }
+
+}  // namespace tsimd
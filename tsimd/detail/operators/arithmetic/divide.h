@@ -36,6 +36,22 @@ namespace tsimd {
     return pack<T, 1>(p1[0] / p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 operator/(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_div_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 operator/(const vfloat4 &p1, const vfloat4 &p2)
@@ -66,6 +82,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 operator/(const vuint4 &p1, const vuint4 &p2)
+  {
+#if TSIMD_COMPILER_INTEL && defined(__SSE4_2__)
+    return _mm_div_epu32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] / p2[i]);
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vdouble4 operator/(const vdouble4 &p1, const vdouble4 &p2)
   {
 #if defined(__AVX__)
@@ -85,6 +115,7 @@ namespace tsimd {
 #if TSIMD_COMPILER_INTEL && defined(__AVX2__)
     return _mm256_div_epi64(p1, p2);
 #else
+    TSIMD_SCALAR_FALLBACK("vllong4 operator/");
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
@@ -115,6 +146,15 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 operator/(const vuint8 &p1, const vuint8 &p2)
+  {
+#if TSIMD_COMPILER_INTEL && defined(__AVX__)
+    return _mm256_div_epu32(p1, p2);
+#else
+    return vuint8(vuint4(p1.vl) / vuint4(p2.vl), vuint4(p1.vh) / vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vdouble8 operator/(const vdouble8 &p1, const vdouble8 &p2)
   {
 #if defined(__AVX512F__)
@@ -156,6 +196,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 operator/(const vuint16 &p1, const vuint16 &p2)
+  {
+#if TSIMD_COMPILER_INTEL && defined(__AVX512F__)
+    return _mm512_div_epu32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) / vuint8(p2.vl),
+                   vuint8(p1.vh) / vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vdouble16 operator/(const vdouble16 &p1, const vdouble16 &p2)
   {
     return vdouble16(vdouble8(p1.vl) / vdouble8(p2.vl),
@@ -168,6 +218,33 @@ namespace tsimd {
                     vllong8(p1.vh) / vllong8(p2.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator/(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p1.vl) / half_t(p2.vl),
+                      half_t(p1.vh) / half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  // NOTE(jda) - there is no packed 8/16-bit integer division (not even in
+  //             SVML), so these are always divided element-wise.
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> operator/(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(p1[i] / p2[i]);
+
+    return result;
+  }
+
   // Inferred pack-pack promotion operators (e.g. 'vint' to 'vfloat') /////////
 
   template <typename T1,
@@ -28,6 +28,72 @@
 
 namespace tsimd {
 
+  namespace detail {
+
+    // NOTE(jda) - neither AVX2 nor AVX512F have a 64-bit low multiply, so
+    //             build one out of 32x32->64 bit multiplies: the high*low
+    //             cross products only contribute to the upper 32 bits.
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i mullo_epi64(__m256i a, __m256i b)
+    {
+      const __m256i lo    = _mm256_mul_epu32(a, b);
+      const __m256i cross = _mm256_add_epi64(
+          _mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+          _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+      return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+    }
+#endif
+
+#if defined(__AVX512F__)
+    TSIMD_INLINE __m512i mullo_epi64(__m512i a, __m512i b)
+    {
+      const __m512i lo    = _mm512_mul_epu32(a, b);
+      const __m512i cross = _mm512_add_epi64(
+          _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b),
+          _mm512_mul_epu32(a, _mm512_srli_epi64(b, 32)));
+      return _mm512_add_epi64(lo, _mm512_slli_epi64(cross, 32));
+    }
+#endif
+
+    // NOTE(jda) - there is no 8-bit multiply either: multiply the even and odd
+    //             bytes as 16-bit lanes and merge the low byte of each product.
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i mullo_epi8(__m128i a, __m128i b)
+    {
+      const __m128i even = _mm_mullo_epi16(a, b);
+      const __m128i odd =
+          _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+      return _mm_or_si128(_mm_slli_epi16(odd, 8),
+                          _mm_and_si128(even, _mm_set1_epi16(0x00FF)));
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i mullo_epi8(__m256i a, __m256i b)
+    {
+      const __m256i even = _mm256_mullo_epi16(a, b);
+      const __m256i odd =
+          _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+      return _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                             _mm256_and_si256(even, _mm256_set1_epi16(0x00FF)));
+    }
+#endif
+
+#if defined(__AVX512BW__)
+    TSIMD_INLINE __m512i mullo_epi8(__m512i a, __m512i b)
+    {
+      const __m512i even = _mm512_mullo_epi16(a, b);
+      const __m512i odd =
+          _mm512_mullo_epi16(_mm512_srli_epi16(a, 8), _mm512_srli_epi16(b, 8));
+      return _mm512_or_si512(_mm512_slli_epi16(odd, 8),
+                             _mm512_and_si512(even, _mm512_set1_epi16(0x00FF)));
+    }
+#endif
+
+  }  // namespace detail
+
   // 1-wide //
 
   template <typename T>
@@ -36,6 +102,22 @@ namespace tsimd {
     return pack<T, 1>(p1[0] * p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 operator*(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_mul_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] * p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 operator*(const vfloat4 &p1, const vfloat4 &p2)
@@ -66,6 +148,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 operator*(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_1__)
+    return _mm_mullo_epi32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] * p2[i]);
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vdouble4 operator*(const vdouble4 &p1, const vdouble4 &p2)
   {
 #if defined(__AVX__)
@@ -82,12 +178,19 @@ namespace tsimd {
 
   TSIMD_INLINE vllong4 operator*(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX512DQ__) && defined(__AVX512VL__)
+    return _mm256_mullo_epi64(p1, p2);
+#elif defined(__AVX2__)
+    return detail::mullo_epi64(p1, p2);
+#else
+    TSIMD_SCALAR_FALLBACK("vllong4 operator*");
     vllong4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] * p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -113,6 +216,17 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 operator*(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mullo_epi32(p1, p2);
+#elif defined(__AVX__)
+    return vuint8(_mm_mullo_epi32(p1.vl, p2.vl), _mm_mullo_epi32(p1.vh, p2.vh));
+#else
+    return vuint8(vuint4(p1.vl) * vuint4(p2.vl), vuint4(p1.vh) * vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vdouble8 operator*(const vdouble8 &p1, const vdouble8 &p2)
   {
 #if defined(__AVX512F__)
@@ -125,8 +239,14 @@ namespace tsimd {
 
   TSIMD_INLINE vllong8 operator*(const vllong8 &p1, const vllong8 &p2)
   {
+#if defined(__AVX512DQ__)
+    return _mm512_mullo_epi64(p1, p2);
+#elif defined(__AVX512F__)
+    return detail::mullo_epi64(p1, p2);
+#else
     return vllong8(vllong4(p1.vl) * vllong4(p2.vl),
                    vllong4(p1.vh) * vllong4(p2.vh));
+#endif
   }
 
   // 16-wide //
@@ -150,6 +270,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 operator*(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_mullo_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) * vuint8(p2.vl),
+                   vuint8(p1.vh) * vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vdouble16 operator*(const vdouble16 &p1, const vdouble16 &p2)
   {
     return vdouble16(vdouble8(p1.vl) * vdouble8(p2.vl),
@@ -162,6 +292,132 @@ namespace tsimd {
                     vllong8(p1.vh) * vllong8(p2.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator*(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p1.vl) * half_t(p2.vl),
+                      half_t(p1.vh) * half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> operator*(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(unsigned(p1[i]) * unsigned(p2[i]));
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 operator*(const vchar16 &p1, const vchar16 &p2)
+  {
+    return detail::mullo_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vuchar16 operator*(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return detail::mullo_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vshort8 operator*(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_mullo_epi16(p1, p2);
+  }
+
+  TSIMD_INLINE vushort8 operator*(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_mullo_epi16(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 operator*(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return detail::mullo_epi8(p1, p2);
+#else
+    return vchar32(vchar16(p1.vl) * vchar16(p2.vl),
+                   vchar16(p1.vh) * vchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 operator*(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return detail::mullo_epi8(p1, p2);
+#else
+    return vuchar32(vuchar16(p1.vl) * vuchar16(p2.vl),
+                    vuchar16(p1.vh) * vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator*(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mullo_epi16(p1, p2);
+#else
+    return vshort16(vshort8(p1.vl) * vshort8(p2.vl),
+                    vshort8(p1.vh) * vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 operator*(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_mullo_epi16(p1, p2);
+#else
+    return vushort16(vushort8(p1.vl) * vushort8(p2.vl),
+                     vushort8(p1.vh) * vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 operator*(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return detail::mullo_epi8(p1, p2);
+#else
+    return vchar64(vchar32(p1.vl) * vchar32(p2.vl),
+                   vchar32(p1.vh) * vchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 operator*(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return detail::mullo_epi8(p1, p2);
+#else
+    return vuchar64(vuchar32(p1.vl) * vuchar32(p2.vl),
+                    vuchar32(p1.vh) * vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator*(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mullo_epi16(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) * vshort16(p2.vl),
+                    vshort16(p1.vh) * vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 operator*(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_mullo_epi16(p1, p2);
+#else
+    return vushort32(vushort16(p1.vl) * vushort16(p2.vl),
+                     vushort16(p1.vh) * vushort16(p2.vh));
+#endif
+  }
+
   // Inferred pack-pack promotion operators (e.g. 'vint' to 'vfloat') /////////
 
   template <typename T1,
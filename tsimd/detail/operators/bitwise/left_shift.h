@@ -21,15 +21,17 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
 // DEALINGS IN THE SOFTWARE.                                                  //
 // ========================================================================== //
-
 #pragma once
 
 #include "../../pack.h"
 
 namespace tsimd {
 
+  // binary operator<<() //////////////////////////////////////////////////////
+
   template <typename T, int W>
-  TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p1, const pack<T, W> &p2)
+  TSIMD_INLINE traits::unsplit_pack_result_t<T, W, pack<T, W>> operator<<(
+      const pack<T, W> &p1, const pack<T, W> &p2)
   {
     pack<T, W> result;
 
@@ -39,6 +41,334 @@ namespace tsimd {
     return result;
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 operator<<(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi64(p1, p2);
+#elif defined(__SSE4_2__)
+    const __m128i lo = _mm_sll_epi64(p1, p2);
+    const __m128i hi = _mm_sll_epi64(p1, _mm_unpackhi_epi64(p2, p2));
+    return _mm_blend_epi16(lo, hi, 0xF0);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] << p2[i]);
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 operator<<(const vint4 &p1, const vint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi32(p1, p2);
+#elif defined(__SSE4_2__)
+    // NOTE(jda) - 2^n is built in the exponent field of a float, converted
+    //             back to an integer and used as a multiplier
+    const __m128i pow2 = _mm_cvttps_epi32(_mm_castsi128_ps(
+        _mm_add_epi32(_mm_slli_epi32(p2, 23), _mm_set1_epi32(0x3F800000))));
+    return _mm_mullo_epi32(p1, pow2);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] << p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 operator<<(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_sllv_epi32(p1, p2);
+#elif defined(__SSE4_2__)
+    const __m128i pow2 = _mm_cvttps_epi32(_mm_castsi128_ps(
+        _mm_add_epi32(_mm_slli_epi32(p2, 23), _mm_set1_epi32(0x3F800000))));
+    return _mm_mullo_epi32(p1, pow2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] << p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 operator<<(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi64(p1, p2);
+#else
+    return vllong4(vllong2(p1.vl) << vllong2(p2.vl),
+                   vllong2(p1.vh) << vllong2(p2.vh));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 operator<<(const vint8 &p1, const vint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi32(p1, p2);
+#else
+    return vint8(vint4(p1.vl) << vint4(p2.vl), vint4(p1.vh) << vint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 operator<<(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_sllv_epi32(p1, p2);
+#else
+    return vuint8(vuint4(p1.vl) << vuint4(p2.vl),
+                  vuint4(p1.vh) << vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 operator<<(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi64(p1, p2);
+#else
+    return vllong8(vllong4(p1.vl) << vllong4(p2.vl),
+                   vllong4(p1.vh) << vllong4(p2.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 operator<<(const vint16 &p1, const vint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi32(p1, p2);
+#else
+    return vint16(vint8(p1.vl) << vint8(p2.vl), vint8(p1.vh) << vint8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 operator<<(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_sllv_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) << vuint8(p2.vl),
+                   vuint8(p1.vh) << vuint8(p2.vh));
+#endif
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator<<(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p1.vl) << half_t(p2.vl),
+                      half_t(p1.vh) << half_t(p2.vh));
+  }
+
+  // Uniform shift counts /////////////////////////////////////////////////////
+
+  // NOTE(jda) - every lane is shifted by the same (not necessarily constant)
+  //             count, which maps to the SSE/AVX shift-by-scalar forms and
+  //             folds into the immediate encodings for constant counts
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 operator<<(const vllong2 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_slli_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p[i] << n);
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 operator<<(const vint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_slli_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p[i] << n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 operator<<(const vuint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_slli_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p[i] << n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 operator<<(const vllong4 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi64(p, n);
+#else
+    return vllong4(vllong2(p.vl) << n, vllong2(p.vh) << n);
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 operator<<(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi32(p, n);
+#elif defined(__AVX__)
+    return vint8(_mm_slli_epi32(p.vl, n), _mm_slli_epi32(p.vh, n));
+#else
+    return vint8(vint4(p.vl) << n, vint4(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vuint8 operator<<(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi32(p, n);
+#elif defined(__AVX__)
+    return vuint8(_mm_slli_epi32(p.vl, n), _mm_slli_epi32(p.vh, n));
+#else
+    return vuint8(vuint4(p.vl) << n, vuint4(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vllong8 operator<<(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi64(p, n);
+#else
+    return vllong8(vllong4(p.vl) << n, vllong4(p.vh) << n);
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 operator<<(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi32(p, n);
+#else
+    return vint16(vint8(p.vl) << n, vint8(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vuint16 operator<<(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_slli_epi32(p, n);
+#else
+    return vuint16(vuint8(p.vl) << n, vuint8(p.vh) << n);
+#endif
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator<<(
+      const pack<T, W> &p, int n)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p.vl) << n, half_t(p.vh) << n);
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE pack<T, W> operator<<(const pack<T, W> &p, int n)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(p[i] << n);
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vshort8 operator<<(const vshort8 &p, int n)
+  {
+    return _mm_slli_epi16(p, n);
+  }
+
+  TSIMD_INLINE vushort8 operator<<(const vushort8 &p, int n)
+  {
+    return _mm_slli_epi16(p, n);
+  }
+#endif
+
+  TSIMD_INLINE vshort16 operator<<(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi16(p, n);
+#else
+    return vshort16(vshort8(p.vl) << n, vshort8(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vushort16 operator<<(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_slli_epi16(p, n);
+#else
+    return vushort16(vushort8(p.vl) << n, vushort8(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator<<(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_slli_epi16(p, n);
+#else
+    return vshort32(vshort16(p.vl) << n, vshort16(p.vh) << n);
+#endif
+  }
+
+  TSIMD_INLINE vushort32 operator<<(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_slli_epi16(p, n);
+#else
+    return vushort32(vushort16(p.vl) << n, vushort16(p.vh) << n);
+#endif
+  }
+
+  // shift_left<N>() //////////////////////////////////////////////////////////
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_left(const pack<T, W> &p)
+  {
+    static_assert(N >= 0 && N < int(sizeof(T) * 8),
+                  "shift_left<N>() count must be less than the element size");
+    return p << N;
+  }
+
   // Inferred pack<>/scalar operators /////////////////////////////////////////
 
   template <typename T,
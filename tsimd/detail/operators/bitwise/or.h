@@ -38,6 +38,50 @@ namespace tsimd {
     return pack<T, 1>(p1[0] | p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vdouble2 operator|(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_or_pd(p1, p2);
+#else
+    vdouble2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (const long long &)p1[i] | (const long long &)p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong2 operator|(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_or_si128(p1, p2);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = p1[i] | p2[i];
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator|(const vboold2 &p1, const vboold2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_or_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = p1[i] | p2[i];
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vfloat4 operator|(const vfloat4 &p1, const vfloat4 &p2)
@@ -68,6 +112,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint4 operator|(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_or_si128(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = p1[i] | p2[i];
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vboolf4 operator|(const vboolf4 &p1, const vboolf4 &p2)
   {
 #if defined(__SSE4_2__)
@@ -148,6 +206,18 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint8 operator|(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vuint8(vuint4(p1.vl) | vuint4(p2.vl), vuint4(p1.vh) | vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf8 operator|(const vboolf8 &p1, const vboolf8 &p2)
   {
 #if defined(__AVX512VL__)
@@ -211,6 +281,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vuint16 operator|(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_or_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) | vuint8(p2.vl),
+                   vuint8(p1.vh) | vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf16 operator|(const vboolf16 &p1, const vboolf16 &p2)
   {
 #if defined(__AVX512F__)
@@ -243,6 +323,202 @@ namespace tsimd {
 #endif
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator|(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p1.vl) | half_t(p2.vl),
+                      half_t(p1.vh) | half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_element_t<T>>
+  TSIMD_INLINE pack<T, W> operator|(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(p1[i] | p2[i]);
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vchar16 operator|(const vchar16 &p1, const vchar16 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+
+  TSIMD_INLINE vuchar16 operator|(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+
+  TSIMD_INLINE vshort8 operator|(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+
+  TSIMD_INLINE vushort8 operator|(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vchar32 operator|(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vchar32(vchar16(p1.vl) | vchar16(p2.vl),
+                   vchar16(p1.vh) | vchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar32 operator|(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vuchar32(vuchar16(p1.vl) | vuchar16(p2.vl),
+                    vuchar16(p1.vh) | vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort16 operator|(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vshort16(vshort8(p1.vl) | vshort8(p2.vl),
+                    vshort8(p1.vh) | vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 operator|(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vushort16(vushort8(p1.vl) | vushort8(p2.vl),
+                     vushort8(p1.vh) | vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vchar64 operator|(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vchar64(vchar32(p1.vl) | vchar32(p2.vl),
+                   vchar32(p1.vh) | vchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuchar64 operator|(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vuchar64(vuchar32(p1.vl) | vuchar32(p2.vl),
+                    vuchar32(p1.vh) | vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 operator|(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vshort32(vshort16(p1.vl) | vshort16(p2.vl),
+                    vshort16(p1.vh) | vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 operator|(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vushort32(vushort16(p1.vl) | vushort16(p2.vl),
+                     vushort16(p1.vh) | vushort16(p2.vh));
+#endif
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vboolc16 operator|(const vboolc16 &p1, const vboolc16 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+
+  TSIMD_INLINE vbools8 operator|(const vbools8 &p1, const vbools8 &p2)
+  {
+    return _mm_or_si128(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vboolc32 operator|(const vboolc32 &p1, const vboolc32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vboolc32(vboolc16(p1.vl) | vboolc16(p2.vl),
+                    vboolc16(p1.vh) | vboolc16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator|(const vbools16 &p1, const vbools16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_or_si256(p1, p2);
+#elif defined(__AVX__)
+    return _mm256_castps_si256(
+        _mm256_or_ps(_mm256_castsi256_ps(p1), _mm256_castsi256_ps(p2)));
+#else
+    return vbools16(vbools8(p1.vl) | vbools8(p2.vl),
+                    vbools8(p1.vh) | vbools8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator|(const vboolc64 &p1, const vboolc64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vboolc64(vboolc32(p1.vl) | vboolc32(p2.vl),
+                    vboolc32(p1.vh) | vboolc32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator|(const vbools32 &p1, const vbools32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_or_si512(p1, p2);
+#else
+    return vbools32(vbools16(p1.vl) | vbools16(p2.vl),
+                    vbools16(p1.vh) | vbools16(p2.vh));
+#endif
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
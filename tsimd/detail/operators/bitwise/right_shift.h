@@ -21,15 +21,19 @@
 // FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
 // DEALINGS IN THE SOFTWARE.                                                  //
 // ========================================================================== //
-
 #pragma once
 
+#include <type_traits>
+
 #include "../../pack.h"
 
 namespace tsimd {
 
+  // binary operator>>() //////////////////////////////////////////////////////
+
   template <typename T, int W>
-  TSIMD_INLINE pack<T, W> operator>>(const pack<T, W> &p1, const pack<T, W> &p2)
+  TSIMD_INLINE traits::unsplit_pack_result_t<T, W, pack<T, W>> operator>>(
+      const pack<T, W> &p1, const pack<T, W> &p2)
   {
     pack<T, W> result;
 
@@ -39,6 +43,588 @@ namespace tsimd {
     return result;
   }
 
+  // NOTE(jda) - there is no 64-bit arithmetic right shift before AVX-512, so
+  //             negative lanes are flipped, shifted logically and flipped
+  //             back: (x ^ s) >> n ^ s where s is the sign of x
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 operator>>(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm_srav_epi64(p1, p2);
+#elif defined(__AVX2__)
+    const __m128i s = _mm_cmpgt_epi64(_mm_setzero_si128(), p1);
+    return _mm_xor_si128(_mm_srlv_epi64(_mm_xor_si128(p1, s), p2), s);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] >> p2[i]);
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 operator>>(const vint4 &p1, const vint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_srav_epi32(p1, p2);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] >> p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 operator>>(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm_srlv_epi32(p1, p2);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] >> p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 operator>>(const vllong4 &p1, const vllong4 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_srav_epi64(p1, p2);
+#elif defined(__AVX2__)
+    const __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p1);
+    return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(p1, s), p2),
+                            s);
+#else
+    return vllong4(vllong2(p1.vl) >> vllong2(p2.vl),
+                   vllong2(p1.vh) >> vllong2(p2.vh));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 operator>>(const vint8 &p1, const vint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_srav_epi32(p1, p2);
+#else
+    return vint8(vint4(p1.vl) >> vint4(p2.vl), vint4(p1.vh) >> vint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 operator>>(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_srlv_epi32(p1, p2);
+#else
+    return vuint8(vuint4(p1.vl) >> vuint4(p2.vl),
+                  vuint4(p1.vh) >> vuint4(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 operator>>(const vllong8 &p1, const vllong8 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srav_epi64(p1, p2);
+#else
+    return vllong8(vllong4(p1.vl) >> vllong4(p2.vl),
+                   vllong4(p1.vh) >> vllong4(p2.vh));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 operator>>(const vint16 &p1, const vint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srav_epi32(p1, p2);
+#else
+    return vint16(vint8(p1.vl) >> vint8(p2.vl), vint8(p1.vh) >> vint8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 operator>>(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srlv_epi32(p1, p2);
+#else
+    return vuint16(vuint8(p1.vl) >> vuint8(p2.vl),
+                   vuint8(p1.vh) >> vuint8(p2.vh));
+#endif
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator>>(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(half_t(p1.vl) >> half_t(p2.vl),
+                      half_t(p1.vh) >> half_t(p2.vh));
+  }
+
+  // shift_right_arithmetic() /////////////////////////////////////////////////
+
+  // NOTE(jda) - shifts every lane by the same count and replicates the sign
+  //             bit, regardless of the signedness of T
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::unsplit_pack_result_t<T, W, pack<T, W>>
+  shift_right_arithmetic(const pack<T, W> &p, int n)
+  {
+    using signed_t = typename std::make_signed<T>::type;
+
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(static_cast<signed_t>(p[i]) >> n);
+
+    return result;
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 shift_right_arithmetic(const vllong2 &p, int n)
+  {
+#if defined(__AVX512VL__)
+    return _mm_srai_epi64(p, n);
+#elif defined(__SSE4_2__)
+    const __m128i s = _mm_cmpgt_epi64(_mm_setzero_si128(), p);
+    return _mm_xor_si128(_mm_srli_epi64(_mm_xor_si128(p, s), n), s);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p[i] >> n);
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 shift_right_arithmetic(const vint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_srai_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p[i] >> n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 shift_right_arithmetic(const vuint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_srai_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = static_cast<unsigned int>(static_cast<int>(p[i]) >> n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 shift_right_arithmetic(const vllong4 &p, int n)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_srai_epi64(p, n);
+#elif defined(__AVX2__)
+    const __m256i s = _mm256_cmpgt_epi64(_mm256_setzero_si256(), p);
+    return _mm256_xor_si256(_mm256_srli_epi64(_mm256_xor_si256(p, s), n), s);
+#else
+    return vllong4(shift_right_arithmetic(vllong2(p.vl), n),
+                   shift_right_arithmetic(vllong2(p.vh), n));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 shift_right_arithmetic(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi32(p, n);
+#elif defined(__AVX__)
+    return vint8(_mm_srai_epi32(p.vl, n), _mm_srai_epi32(p.vh, n));
+#else
+    return vint8(shift_right_arithmetic(vint4(p.vl), n),
+                 shift_right_arithmetic(vint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 shift_right_arithmetic(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi32(p, n);
+#elif defined(__AVX__)
+    return vuint8(_mm_srai_epi32(p.vl, n), _mm_srai_epi32(p.vh, n));
+#else
+    return vuint8(shift_right_arithmetic(vuint4(p.vl), n),
+                  shift_right_arithmetic(vuint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 shift_right_arithmetic(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi64(p, n);
+#else
+    return vllong8(shift_right_arithmetic(vllong4(p.vl), n),
+                   shift_right_arithmetic(vllong4(p.vh), n));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 shift_right_arithmetic(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi32(p, n);
+#else
+    return vint16(shift_right_arithmetic(vint8(p.vl), n),
+                  shift_right_arithmetic(vint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 shift_right_arithmetic(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srai_epi32(p, n);
+#else
+    return vuint16(shift_right_arithmetic(vuint8(p.vl), n),
+                   shift_right_arithmetic(vuint8(p.vh), n));
+#endif
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>>
+  shift_right_arithmetic(const pack<T, W> &p, int n)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(shift_right_arithmetic(half_t(p.vl), n),
+                      shift_right_arithmetic(half_t(p.vh), n));
+  }
+
+  // 16-bit //
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vshort8 shift_right_arithmetic(const vshort8 &p, int n)
+  {
+    return _mm_srai_epi16(p, n);
+  }
+
+  TSIMD_INLINE vushort8 shift_right_arithmetic(const vushort8 &p, int n)
+  {
+    return _mm_srai_epi16(p, n);
+  }
+#endif
+
+  TSIMD_INLINE vshort16 shift_right_arithmetic(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi16(p, n);
+#else
+    return vshort16(shift_right_arithmetic(vshort8(p.vl), n),
+                    shift_right_arithmetic(vshort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 shift_right_arithmetic(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srai_epi16(p, n);
+#else
+    return vushort16(shift_right_arithmetic(vushort8(p.vl), n),
+                     shift_right_arithmetic(vushort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 shift_right_arithmetic(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srai_epi16(p, n);
+#else
+    return vshort32(shift_right_arithmetic(vshort16(p.vl), n),
+                    shift_right_arithmetic(vshort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 shift_right_arithmetic(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srai_epi16(p, n);
+#else
+    return vushort32(shift_right_arithmetic(vushort16(p.vl), n),
+                     shift_right_arithmetic(vushort16(p.vh), n));
+#endif
+  }
+
+  // shift_right_logical() ////////////////////////////////////////////////////
+
+  // NOTE(jda) - shifts every lane by the same count and fills with zeros,
+  //             regardless of the signedness of T
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::unsplit_pack_result_t<T, W, pack<T, W>>
+  shift_right_logical(const pack<T, W> &p, int n)
+  {
+    using unsigned_t = typename std::make_unsigned<T>::type;
+
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = static_cast<T>(static_cast<unsigned_t>(p[i]) >> n);
+
+    return result;
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vllong2 shift_right_logical(const vllong2 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_srli_epi64(p, n);
+#else
+    vllong2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = static_cast<long long>(
+          static_cast<unsigned long long>(p[i]) >> n);
+
+    return result;
+#endif
+  }
+
+  // 4-wide //
+
+  TSIMD_INLINE vint4 shift_right_logical(const vint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_srli_epi32(p, n);
+#else
+    vint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = static_cast<int>(static_cast<unsigned int>(p[i]) >> n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vuint4 shift_right_logical(const vuint4 &p, int n)
+  {
+#if defined(__SSE4_2__)
+    return _mm_srli_epi32(p, n);
+#else
+    vuint4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p[i] >> n);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vllong4 shift_right_logical(const vllong4 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi64(p, n);
+#else
+    return vllong4(shift_right_logical(vllong2(p.vl), n),
+                   shift_right_logical(vllong2(p.vh), n));
+#endif
+  }
+
+  // 8-wide //
+
+  TSIMD_INLINE vint8 shift_right_logical(const vint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi32(p, n);
+#elif defined(__AVX__)
+    return vint8(_mm_srli_epi32(p.vl, n), _mm_srli_epi32(p.vh, n));
+#else
+    return vint8(shift_right_logical(vint4(p.vl), n),
+                 shift_right_logical(vint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint8 shift_right_logical(const vuint8 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi32(p, n);
+#elif defined(__AVX__)
+    return vuint8(_mm_srli_epi32(p.vl, n), _mm_srli_epi32(p.vh, n));
+#else
+    return vuint8(shift_right_logical(vuint4(p.vl), n),
+                  shift_right_logical(vuint4(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vllong8 shift_right_logical(const vllong8 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi64(p, n);
+#else
+    return vllong8(shift_right_logical(vllong4(p.vl), n),
+                   shift_right_logical(vllong4(p.vh), n));
+#endif
+  }
+
+  // 16-wide //
+
+  TSIMD_INLINE vint16 shift_right_logical(const vint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi32(p, n);
+#else
+    return vint16(shift_right_logical(vint8(p.vl), n),
+                  shift_right_logical(vint8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vuint16 shift_right_logical(const vuint16 &p, int n)
+  {
+#if defined(__AVX512F__)
+    return _mm512_srli_epi32(p, n);
+#else
+    return vuint16(shift_right_logical(vuint8(p.vl), n),
+                   shift_right_logical(vuint8(p.vh), n));
+#endif
+  }
+
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>>
+  shift_right_logical(const pack<T, W> &p, int n)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(shift_right_logical(half_t(p.vl), n),
+                      shift_right_logical(half_t(p.vh), n));
+  }
+
+  // 16-bit //
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vshort8 shift_right_logical(const vshort8 &p, int n)
+  {
+    return _mm_srli_epi16(p, n);
+  }
+
+  TSIMD_INLINE vushort8 shift_right_logical(const vushort8 &p, int n)
+  {
+    return _mm_srli_epi16(p, n);
+  }
+#endif
+
+  TSIMD_INLINE vshort16 shift_right_logical(const vshort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi16(p, n);
+#else
+    return vshort16(shift_right_logical(vshort8(p.vl), n),
+                    shift_right_logical(vshort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort16 shift_right_logical(const vushort16 &p, int n)
+  {
+#if defined(__AVX2__)
+    return _mm256_srli_epi16(p, n);
+#else
+    return vushort16(shift_right_logical(vushort8(p.vl), n),
+                     shift_right_logical(vushort8(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vshort32 shift_right_logical(const vshort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srli_epi16(p, n);
+#else
+    return vshort32(shift_right_logical(vshort16(p.vl), n),
+                    shift_right_logical(vshort16(p.vh), n));
+#endif
+  }
+
+  TSIMD_INLINE vushort32 shift_right_logical(const vushort32 &p, int n)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_srli_epi16(p, n);
+#else
+    return vushort32(shift_right_logical(vushort16(p.vl), n),
+                     shift_right_logical(vushort16(p.vh), n));
+#endif
+  }
+
+  // Uniform shift counts /////////////////////////////////////////////////////
+
+  // NOTE(jda) - signed elements shift arithmetically and unsigned elements
+  //             shift logically, the same as the scalar operator>>()
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::enable_if_t<
+      std::is_integral<T>::value && std::is_signed<T>::value,
+      pack<T, W>>
+  operator>>(const pack<T, W> &p, int n)
+  {
+    return shift_right_arithmetic(p, n);
+  }
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::enable_if_t<std::is_unsigned<T>::value, pack<T, W>>
+  operator>>(const pack<T, W> &p, int n)
+  {
+    return shift_right_logical(p, n);
+  }
+
+  // shift_right<N>() /////////////////////////////////////////////////////////
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_right(const pack<T, W> &p)
+  {
+    static_assert(N >= 0 && N < int(sizeof(T) * 8),
+                  "shift_right<N>() count must be less than the element size");
+    return p >> N;
+  }
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_right_arithmetic(const pack<T, W> &p)
+  {
+    static_assert(N >= 0 && N < int(sizeof(T) * 8),
+                  "shift_right_arithmetic<N>() count must be less than the "
+                  "element size");
+    return shift_right_arithmetic(p, N);
+  }
+
+  template <int N, typename T, int W>
+  TSIMD_INLINE pack<T, W> shift_right_logical(const pack<T, W> &p)
+  {
+    static_assert(N >= 0 && N < int(sizeof(T) * 8),
+                  "shift_right_logical<N>() count must be less than the "
+                  "element size");
+    return shift_right_logical(p, N);
+  }
+
   // Inferred pack<>/scalar operators /////////////////////////////////////////
 
   template <typename T,
@@ -36,6 +36,51 @@ namespace tsimd {
     return mask<T, 1>(p1[0] == p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator==(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cmpeq_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator==(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_pd(_mm_cmpeq_epi64(p1, p2));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator==(const vboold2 &p1, const vboold2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_pd(
+        _mm_cmpeq_epi64(_mm_castpd_si128(p1), _mm_castpd_si128(p2)));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator==(const vfloat4 &p1, const vfloat4 &p2)
@@ -66,6 +111,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf4 operator==(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_ps(_mm_cmpeq_epi32(p1, p2));
+#else
+    vboolf4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] == p2[i]);
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vboolf4 operator==(const vboolf4 &p1, const vboolf4 &p2)
   {
 #if defined(__SSE4_2__)
@@ -82,32 +141,50 @@ namespace tsimd {
 
   TSIMD_INLINE vboold4 operator==(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_EQ_OQ);
+#else
+    TSIMD_SCALAR_FALLBACK("vdouble4 operator==");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator==(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(p1, p2));
+#else
+    TSIMD_SCALAR_FALLBACK("vllong4 operator==");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator==(const vboold4 &p1, const vboold4 &p2)
   {
+#if defined(__AVX2__)
+    return _mm256_castsi256_pd(
+        _mm256_cmpeq_epi64(_mm256_castpd_si256(p1), _mm256_castpd_si256(p2)));
+#elif defined(__AVX__)
+    return _mm256_xor_pd(_mm256_xor_pd(p1, p2), vboold4(true));
+#else
+    TSIMD_SCALAR_FALLBACK("vboold4 operator==");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] == p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -115,7 +192,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf8 operator==(const vfloat8 &p1, const vfloat8 &p2)
   {
 #if defined(__AVX512VL__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_EQ);
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_EQ_OQ);
 #elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_EQ_OQ);
 #else
@@ -138,12 +215,30 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf8 operator==(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epi32_mask(p1, p2, _MM_CMPINT_EQ);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_ps(_mm256_cmpeq_epi32(p1, p2));
+#elif defined(__AVX__)
+    return vboolf8(_mm_castsi128_ps(_mm_cmpeq_epi32(p1.vl, p2.vl)),
+                   _mm_castsi128_ps(_mm_cmpeq_epi32(p1.vh, p2.vh)));
+#else
+    return vboolf8(vuint4(p1.vl) == vuint4(p2.vl),
+                   vuint4(p1.vh) == vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf8 operator==(const vboolf8 &p1, const vboolf8 &p2)
   {
 #if defined(__AVX512VL__)
     return _mm512_kxnor(p1, p2);
-#elif defined(__AVX2__) || defined(__AVX__)
-    return _mm256_cmp_ps(p1, p2, _CMP_EQ_OQ);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(_mm256_castps_si256(p1), _mm256_castps_si256(p2)));
+#elif defined(__AVX__)
+    return _mm256_xor_ps(_mm256_xor_ps(p1, p2), vboolf8(true));
 #else
     return vboolf8(vboolf4(p1.vl) == vboolf4(p2.vl),
                    vboolf4(p1.vh) == vboolf4(p2.vh));
@@ -185,7 +280,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator==(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_EQ);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_EQ_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) == vfloat8(p2.vl),
                     vfloat8(p1.vh) == vfloat8(p2.vh));
@@ -201,6 +296,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf16 operator==(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epi32_mask(p1, p2, _MM_CMPINT_EQ);
+#else
+    return vboolf16(vuint8(p1.vl) == vuint8(p2.vl),
+                    vuint8(p1.vh) == vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboolf16 operator==(const vboolf16 &p1, const vboolf16 &p2)
   {
 #if defined(__AVX512F__)
@@ -229,6 +334,132 @@ namespace tsimd {
                     vboold8(p1.vh) == vboold8(p2.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, mask<T, W>> operator==(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return mask<T, W>(half_t(p1.vl) == half_t(p2.vl),
+                      half_t(p1.vh) == half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE mask<T, W> operator==(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    mask<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = p1[i] == p2[i];
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vboolc16 operator==(const vchar16 &p1, const vchar16 &p2)
+  {
+    return _mm_cmpeq_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vboolc16 operator==(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_cmpeq_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vbools8 operator==(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_cmpeq_epi16(p1, p2);
+  }
+
+  TSIMD_INLINE vbools8 operator==(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_cmpeq_epi16(p1, p2);
+  }
+#endif
+
+  TSIMD_INLINE vboolc32 operator==(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpeq_epi8(p1, p2);
+#else
+    return vboolc32(vchar16(p1.vl) == vchar16(p2.vl),
+                    vchar16(p1.vh) == vchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator==(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpeq_epi8(p1, p2);
+#else
+    return vboolc32(vuchar16(p1.vl) == vuchar16(p2.vl),
+                    vuchar16(p1.vh) == vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator==(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpeq_epi16(p1, p2);
+#else
+    return vbools16(vshort8(p1.vl) == vshort8(p2.vl),
+                    vshort8(p1.vh) == vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator==(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpeq_epi16(p1, p2);
+#else
+    return vbools16(vushort8(p1.vl) == vushort8(p2.vl),
+                    vushort8(p1.vh) == vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator==(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(p1, p2));
+#else
+    return vboolc64(vchar32(p1.vl) == vchar32(p2.vl),
+                    vchar32(p1.vh) == vchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator==(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(p1, p2));
+#else
+    return vboolc64(vuchar32(p1.vl) == vuchar32(p2.vl),
+                    vuchar32(p1.vh) == vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator==(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(p1, p2));
+#else
+    return vbools32(vshort16(p1.vl) == vshort16(p2.vl),
+                    vshort16(p1.vh) == vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator==(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(p1, p2));
+#else
+    return vbools32(vushort16(p1.vl) == vushort16(p2.vl),
+                    vushort16(p1.vh) == vushort16(p2.vh));
+#endif
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
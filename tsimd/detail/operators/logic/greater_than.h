@@ -28,6 +28,63 @@
 
 namespace tsimd {
 
+  namespace detail {
+
+    // NOTE(jda) - SSE/AVX2 only have signed integer compares, flipping the
+    //             sign bit of both sides maps unsigned order onto signed order
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i flip_sign_epi32(const __m128i &v)
+    {
+      return _mm_xor_si128(v, _mm_set1_epi32(0x80000000));
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i flip_sign_epi32(const __m256i &v)
+    {
+      return _mm256_xor_si256(v, _mm256_set1_epi32(0x80000000));
+    }
+#endif
+
+#if defined(__SSE4_2__)
+    TSIMD_INLINE __m128i flip_sign_epi8(const __m128i &v)
+    {
+      return _mm_xor_si128(v, _mm_set1_epi8(static_cast<char>(0x80)));
+    }
+
+    TSIMD_INLINE __m128i flip_sign_epi16(const __m128i &v)
+    {
+      return _mm_xor_si128(v, _mm_set1_epi16(static_cast<short>(0x8000)));
+    }
+#endif
+
+#if defined(__AVX2__)
+    TSIMD_INLINE __m256i flip_sign_epi8(const __m256i &v)
+    {
+      return _mm256_xor_si256(v, _mm256_set1_epi8(static_cast<char>(0x80)));
+    }
+
+    TSIMD_INLINE __m256i flip_sign_epi16(const __m256i &v)
+    {
+      return _mm256_xor_si256(v, _mm256_set1_epi16(static_cast<short>(0x8000)));
+    }
+#endif
+
+#if defined(__AVX512BW__)
+    TSIMD_INLINE __m512i flip_sign_epi8(const __m512i &v)
+    {
+      return _mm512_xor_si512(v, _mm512_set1_epi8(static_cast<char>(0x80)));
+    }
+
+    TSIMD_INLINE __m512i flip_sign_epi16(const __m512i &v)
+    {
+      return _mm512_xor_si512(v, _mm512_set1_epi16(static_cast<short>(0x8000)));
+    }
+#endif
+
+  }  // namespace detail
+
   // 1-wide //
 
   template <typename T>
@@ -36,6 +93,36 @@ namespace tsimd {
     return mask<T, 1>(p1[0] > p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator>(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cmpgt_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] > p2[i]);
+
+    return result;
+#endif
+  }
+
+  TSIMD_INLINE vboold2 operator>(const vllong2 &p1, const vllong2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_pd(_mm_cmpgt_epi64(p1, p2));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] > p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator>(const vfloat4 &p1, const vfloat4 &p2)
@@ -66,24 +153,49 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf4 operator>(const vuint4 &p1, const vuint4 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_castsi128_ps(_mm_cmpgt_epi32(detail::flip_sign_epi32(p1),
+                                            detail::flip_sign_epi32(p2)));
+#else
+    vboolf4 result;
+
+    for (int i = 0; i < 4; ++i)
+      result[i] = (p1[i] > p2[i]);
+
+    return result;
+#endif
+  }
+
   TSIMD_INLINE vboold4 operator>(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_GT_OQ);
+#else
+    TSIMD_SCALAR_FALLBACK("vdouble4 operator>");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] > p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator>(const vllong4 &p1, const vllong4 &p2)
   {
+#if defined(__AVX2__)
+    return _mm256_castsi256_pd(_mm256_cmpgt_epi64(p1, p2));
+#else
+    TSIMD_SCALAR_FALLBACK("vllong4 operator>");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] > p2[i]);
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -91,7 +203,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf8 operator>(const vfloat8 &p1, const vfloat8 &p2)
   {
 #if defined(__AVX512VL__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_GT);
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_GT_OQ);
 #elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_GT_OQ);
 #else
@@ -114,10 +226,23 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf8 operator>(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX512VL__)
+    return _mm256_cmp_epu32_mask(p1, p2, _MM_CMPINT_NLE);
+#elif defined(__AVX2__)
+    return _mm256_castsi256_ps(_mm256_cmpgt_epi32(
+        detail::flip_sign_epi32(p1), detail::flip_sign_epi32(p2)));
+#else
+    return vboolf8(vuint4(p1.vl) > vuint4(p2.vl),
+                   vuint4(p1.vh) > vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboold8 operator>(const vdouble8 &p1, const vdouble8 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_pd_mask(p1, p2, _MM_CMPINT_GT);
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_GT_OQ);
 #else
     return vboold8(vdouble4(p1.vl) > vdouble4(p2.vl),
                    vdouble4(p1.vh) > vdouble4(p2.vh));
@@ -139,7 +264,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator>(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_GT);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_GT_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) > vfloat8(p2.vl),
                     vfloat8(p1.vh) > vfloat8(p2.vh));
@@ -155,6 +280,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf16 operator>(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_NLE);
+#else
+    return vboolf16(vuint8(p1.vl) > vuint8(p2.vl),
+                    vuint8(p1.vh) > vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboold16 operator>(const vdouble16 &p1, const vdouble16 &p2)
   {
     return vboold16(vdouble8(p1.vl) > vdouble8(p2.vl),
@@ -167,6 +302,136 @@ namespace tsimd {
                     vllong8(p1.vh) > vllong8(p2.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, mask<T, W>> operator>(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return mask<T, W>(half_t(p1.vl) > half_t(p2.vl),
+                      half_t(p1.vh) > half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE mask<T, W> operator>(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    mask<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = p1[i] > p2[i];
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vboolc16 operator>(const vchar16 &p1, const vchar16 &p2)
+  {
+    return _mm_cmpgt_epi8(p1, p2);
+  }
+
+  TSIMD_INLINE vboolc16 operator>(const vuchar16 &p1, const vuchar16 &p2)
+  {
+    return _mm_cmpgt_epi8(detail::flip_sign_epi8(p1),
+                          detail::flip_sign_epi8(p2));
+  }
+
+  TSIMD_INLINE vbools8 operator>(const vshort8 &p1, const vshort8 &p2)
+  {
+    return _mm_cmpgt_epi16(p1, p2);
+  }
+
+  TSIMD_INLINE vbools8 operator>(const vushort8 &p1, const vushort8 &p2)
+  {
+    return _mm_cmpgt_epi16(detail::flip_sign_epi16(p1),
+                           detail::flip_sign_epi16(p2));
+  }
+#endif
+
+  TSIMD_INLINE vboolc32 operator>(const vchar32 &p1, const vchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi8(p1, p2);
+#else
+    return vboolc32(vchar16(p1.vl) > vchar16(p2.vl),
+                    vchar16(p1.vh) > vchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc32 operator>(const vuchar32 &p1, const vuchar32 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi8(detail::flip_sign_epi8(p1),
+                             detail::flip_sign_epi8(p2));
+#else
+    return vboolc32(vuchar16(p1.vl) > vuchar16(p2.vl),
+                    vuchar16(p1.vh) > vuchar16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator>(const vshort16 &p1, const vshort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi16(p1, p2);
+#else
+    return vbools16(vshort8(p1.vl) > vshort8(p2.vl),
+                    vshort8(p1.vh) > vshort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator>(const vushort16 &p1, const vushort16 &p2)
+  {
+#if defined(__AVX2__)
+    return _mm256_cmpgt_epi16(detail::flip_sign_epi16(p1),
+                              detail::flip_sign_epi16(p2));
+#else
+    return vbools16(vushort8(p1.vl) > vushort8(p2.vl),
+                    vushort8(p1.vh) > vushort8(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator>(const vchar64 &p1, const vchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmpgt_epi8_mask(p1, p2));
+#else
+    return vboolc64(vchar32(p1.vl) > vchar32(p2.vl),
+                    vchar32(p1.vh) > vchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator>(const vuchar64 &p1, const vuchar64 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi8(_mm512_cmpgt_epu8_mask(p1, p2));
+#else
+    return vboolc64(vuchar32(p1.vl) > vuchar32(p2.vl),
+                    vuchar32(p1.vh) > vuchar32(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator>(const vshort32 &p1, const vshort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmpgt_epi16_mask(p1, p2));
+#else
+    return vbools32(vshort16(p1.vl) > vshort16(p2.vl),
+                    vshort16(p1.vh) > vshort16(p2.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator>(const vushort32 &p1, const vushort32 &p2)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_movm_epi16(_mm512_cmpgt_epu16_mask(p1, p2));
+#else
+    return vbools32(vushort16(p1.vl) > vushort16(p2.vl),
+                    vushort16(p1.vh) > vushort16(p2.vh));
+#endif
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
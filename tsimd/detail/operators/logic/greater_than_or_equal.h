@@ -39,6 +39,22 @@ namespace tsimd {
     return mask<T, 1>(p1[0] >= p2[0]);
   }
 
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator>=(const vdouble2 &p1, const vdouble2 &p2)
+  {
+#if defined(__SSE4_2__)
+    return _mm_cmpge_pd(p1, p2);
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = (p1[i] >= p2[i]);
+
+    return result;
+#endif
+  }
+
   // 4-wide //
 
   TSIMD_INLINE vboolf4 operator>=(const vfloat4 &p1, const vfloat4 &p2)
@@ -60,14 +76,24 @@ namespace tsimd {
     return !(p1 < p2);
   }
 
+  TSIMD_INLINE vboolf4 operator>=(const vuint4 &p1, const vuint4 &p2)
+  {
+    return !(p1 < p2);
+  }
+
   TSIMD_INLINE vboold4 operator>=(const vdouble4 &p1, const vdouble4 &p2)
   {
+#if defined(__AVX__)
+    return _mm256_cmp_pd(p1, p2, _CMP_GE_OQ);
+#else
+    TSIMD_SCALAR_FALLBACK("vdouble4 operator>=");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = (p1[i] >= p2[i]);
 
     return result;
+#endif
   }
 
   TSIMD_INLINE vboold4 operator>=(const vllong4 &p1, const vllong4 &p2)
@@ -80,7 +106,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf8 operator>=(const vfloat8 &p1, const vfloat8 &p2)
   {
 #if defined(__AVX512VL__)
-    return _mm256_cmp_ps_mask(p1, p2, _MM_CMPINT_GE);
+    return _mm256_cmp_ps_mask(p1, p2, _CMP_GE_OQ);
 #elif defined(__AVX2__) || defined(__AVX__)
     return _mm256_cmp_ps(p1, p2, _CMP_GE_OQ);
 #else
@@ -98,10 +124,20 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf8 operator>=(const vuint8 &p1, const vuint8 &p2)
+  {
+#if defined(__AVX2__) || defined(__AVX__)
+    return !(p1 < p2);
+#else
+    return vboolf8(vuint4(p1.vl) >= vuint4(p2.vl),
+                   vuint4(p1.vh) >= vuint4(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboold8 operator>=(const vdouble8 &p1, const vdouble8 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_pd_mask(p1, p2, _MM_CMPINT_GE);
+    return _mm512_cmp_pd_mask(p1, p2, _CMP_GE_OQ);
 #else
     return vboold8(vdouble4(p1.vl) >= vdouble4(p2.vl),
                    vdouble4(p1.vh) >= vdouble4(p2.vh));
@@ -123,7 +159,7 @@ namespace tsimd {
   TSIMD_INLINE vboolf16 operator>=(const vfloat16 &p1, const vfloat16 &p2)
   {
 #if defined(__AVX512F__)
-    return _mm512_cmp_ps_mask(p1, p2, _MM_CMPINT_GE);
+    return _mm512_cmp_ps_mask(p1, p2, _CMP_GE_OQ);
 #else
     return vboolf16(vfloat8(p1.vl) >= vfloat8(p2.vl),
                     vfloat8(p1.vh) >= vfloat8(p2.vh));
@@ -139,6 +175,16 @@ namespace tsimd {
 #endif
   }
 
+  TSIMD_INLINE vboolf16 operator>=(const vuint16 &p1, const vuint16 &p2)
+  {
+#if defined(__AVX512F__)
+    return _mm512_cmp_epu32_mask(p1, p2, _MM_CMPINT_GE);
+#else
+    return vboolf16(vuint8(p1.vl) >= vuint8(p2.vl),
+                    vuint8(p1.vh) >= vuint8(p2.vh));
+#endif
+  }
+
   TSIMD_INLINE vboold16 operator>=(const vdouble16 &p1, const vdouble16 &p2)
   {
     return vboold16(vdouble8(p1.vl) >= vdouble8(p2.vl),
@@ -151,6 +197,25 @@ namespace tsimd {
                     vllong8(p1.vh) >= vllong8(p2.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, mask<T, W>> operator>=(
+      const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    using half_t = pack<T, W / 2>;
+    return mask<T, W>(half_t(p1.vl) >= half_t(p2.vl),
+                      half_t(p1.vh) >= half_t(p2.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_integer_t<T>>
+  TSIMD_INLINE mask<T, W> operator>=(const pack<T, W> &p1, const pack<T, W> &p2)
+  {
+    return !(p2 > p1);
+  }
+
   // Inferred pack-scalar operators ///////////////////////////////////////////
 
   template <typename T,
@@ -31,9 +31,25 @@ namespace tsimd {
   // 1-wide //
 
   template <typename T, typename = traits::is_bool_t<T>>
-  TSIMD_INLINE mask<T, 1> operator!(const mask<T, 1> &m)
+  TSIMD_INLINE pack<T, 1> operator!(const pack<T, 1> &m)
   {
-    return mask<T, 1>(!m[0]);
+    return pack<T, 1>(!m[0]);
+  }
+
+  // 2-wide //
+
+  TSIMD_INLINE vboold2 operator!(const vboold2 &m)
+  {
+#if defined(__SSE4_2__)
+    return _mm_xor_pd(m, vboold2(true));
+#else
+    vboold2 result;
+
+    for (int i = 0; i < 2; ++i)
+      result[i] = !m[i];
+
+    return result;
+#endif
   }
 
   // 4-wide //
@@ -54,12 +70,17 @@ namespace tsimd {
 
   TSIMD_INLINE vboold4 operator!(const vboold4 &m)
   {
+#if defined(__AVX__)
+    return _mm256_xor_pd(m, vboold4(true));
+#else
+    TSIMD_SCALAR_FALLBACK("vboold4 operator!");
     vboold4 result;
 
     for (int i = 0; i < 4; ++i)
       result[i] = !m[i];
 
     return result;
+#endif
   }
 
   // 8-wide //
@@ -100,4 +121,75 @@ namespace tsimd {
     return vboold16(!vboold8(m.vl), !vboold8(m.vh));
   }
 
+  // 2-wide, 32-wide, and 64-wide //
+
+  template <typename T, int W>
+  TSIMD_INLINE traits::split_pack_result_t<T, W, pack<T, W>> operator!(
+      const pack<T, W> &m)
+  {
+    using half_t = pack<T, W / 2>;
+    return pack<T, W>(!half_t(m.vl), !half_t(m.vh));
+  }
+
+  // 8-bit and 16-bit //
+
+  template <typename T, int W, typename = traits::is_small_bool_t<T>>
+  TSIMD_INLINE pack<T, W> operator!(const pack<T, W> &m)
+  {
+    pack<T, W> result;
+
+    for (int i = 0; i < W; ++i)
+      result[i] = !m[i];
+
+    return result;
+  }
+
+#if defined(__SSE4_2__)
+  TSIMD_INLINE vboolc16 operator!(const vboolc16 &m)
+  {
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+  }
+
+  TSIMD_INLINE vbools8 operator!(const vbools8 &m)
+  {
+    return _mm_xor_si128(m, _mm_set1_epi32(-1));
+  }
+#endif
+
+  TSIMD_INLINE vboolc32 operator!(const vboolc32 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vboolc32(!vboolc16(m.vl), !vboolc16(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools16 operator!(const vbools16 &m)
+  {
+#if defined(__AVX2__)
+    return _mm256_xor_si256(m, _mm256_set1_epi32(-1));
+#else
+    return vbools16(!vbools8(m.vl), !vbools8(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vboolc64 operator!(const vboolc64 &m)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vboolc64(!vboolc32(m.vl), !vboolc32(m.vh));
+#endif
+  }
+
+  TSIMD_INLINE vbools32 operator!(const vbools32 &m)
+  {
+#if defined(__AVX512BW__)
+    return _mm512_xor_si512(m, _mm512_set1_epi32(-1));
+#else
+    return vbools32(!vbools16(m.vl), !vbools16(m.vh));
+#endif
+  }
+
 }  // namespace tsimd
\ No newline at end of file
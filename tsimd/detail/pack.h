@@ -31,6 +31,7 @@
 #include "tsimd_traits.h"
 
 #include "utility/bit_iterator.h"
+#include "utility/half.h"
 
 namespace tsimd {
 
@@ -188,11 +189,13 @@ namespace tsimd {
     // Interface checks //
 
     static_assert(traits::valid_type_for_pack<T>::value,
-                  "pack 'T' type currently must be 'float', 'int', 'double',"
-                  " 'long long', 'bool32_t', or 'bool64_t'!");
+                  "pack 'T' type currently must be 'float', 'int',"
+                  " 'unsigned int', 'double', 'long long', '[u]int8_t',"
+                  " '[u]int16_t', or a 'bool{8,16,32,64}_t'!");
 
-    static_assert(W == 1 || W == 4 || W == 8 || W == 16,
-                  "pack 'W' size must be 1, 4, 8, or 16!");
+    static_assert(W == 1 || W == 2 || W == 4 || W == 8 || W == 16 ||
+                      W == 32 || W == 64,
+                  "pack 'W' size must be 1, 2, 4, 8, 16, 32, or 64!");
   };
 
   // mask types and true/false value aliases //////////////////////////////////
@@ -209,6 +212,12 @@ namespace tsimd {
   template <int W = TSIMD_DEFAULT_WIDTH>
   using maskd = pack<bool64_t, W>;
 
+  template <int W>
+  using maskc = pack<bool8_t, W>;
+
+  template <int W>
+  using masks = pack<bool16_t, W>;
+
   // Mask type for a given pack ///////////////////////////////////////////////
 
   template <typename MASK_T>
@@ -235,6 +244,14 @@ namespace tsimd {
   template <int W> using vllongn  = pack<long long, W>;
   template <int W> using vbooldn  = maskd<W>;
 
+  template <int W> using vcharn  = pack<int8_t, W>;
+  template <int W> using vucharn = pack<uint8_t, W>;
+  template <int W> using vboolcn = maskc<W>;
+
+  template <int W> using vshortn  = pack<int16_t, W>;
+  template <int W> using vushortn = pack<uint16_t, W>;
+  template <int W> using vboolsn  = masks<W>;
+
   /* 1-wide shortcuts */
   using vfloat1  = vfloatn<1>;
   using vint1    = vintn<1>;
@@ -245,6 +262,16 @@ namespace tsimd {
   using vdouble1 = vdoublen<1>;
   using vboold1  = maskd<1>;
 
+  /* 2-wide shortcuts */
+  using vfloat2  = vfloatn<2>;
+  using vint2    = vintn<2>;
+  using vuint2   = vuintn<2>;
+  using vboolf2  = maskf<2>;
+
+  using vdouble2 = vdoublen<2>;
+  using vllong2  = vllongn<2>;
+  using vboold2  = maskd<2>;
+
   /* 4-wide shortcuts */
   using vfloat4  = vfloatn<4>;
   using vint4    = vintn<4>;
@@ -275,6 +302,41 @@ namespace tsimd {
   using vllong16  = vllongn<16>;
   using vboold16  = maskd<16>;
 
+  /* 32-wide shortcuts */
+  using vfloat32  = vfloatn<32>;
+  using vint32    = vintn<32>;
+  using vuint32   = vuintn<32>;
+  using vboolf32  = maskf<32>;
+
+  using vdouble32 = vdoublen<32>;
+  using vllong32  = vllongn<32>;
+  using vboold32  = maskd<32>;
+
+  /* 8-bit and 16-bit shortcuts (one per native register size) */
+  using vchar16  = vcharn<16>;
+  using vuchar16 = vucharn<16>;
+  using vboolc16 = vboolcn<16>;
+
+  using vchar32  = vcharn<32>;
+  using vuchar32 = vucharn<32>;
+  using vboolc32 = vboolcn<32>;
+
+  using vchar64  = vcharn<64>;
+  using vuchar64 = vucharn<64>;
+  using vboolc64 = vboolcn<64>;
+
+  using vshort8  = vshortn<8>;
+  using vushort8 = vushortn<8>;
+  using vbools8  = vboolsn<8>;
+
+  using vshort16  = vshortn<16>;
+  using vushort16 = vushortn<16>;
+  using vbools16  = vboolsn<16>;
+
+  using vshort32  = vshortn<32>;
+  using vushort32 = vushortn<32>;
+  using vbools32  = vboolsn<32>;
+
   /* default shortcuts */
   using vfloat  = vfloatn<TSIMD_DEFAULT_WIDTH>;
   using vint    = vintn<TSIMD_DEFAULT_WIDTH>;
@@ -310,6 +372,12 @@ namespace tsimd {
       : v(_mm_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint4::pack(unsigned int value)
+      : v(_mm_set1_epi32(static_cast<int>(value)))
+  {
+  }
 #endif
 
   // 8-wide //
@@ -326,6 +394,12 @@ namespace tsimd {
       : v(_mm256_set1_epi32(value))
   {
   }
+
+  template <>
+  TSIMD_INLINE vuint8::pack(unsigned int value)
+      : v(_mm256_set1_epi32(static_cast<int>(value)))
+  {
+  }
 #endif
 
   // 16-wide //
@@ -343,6 +417,12 @@ namespace tsimd {
   {
   }
 
+  template <>
+  TSIMD_INLINE vuint16::pack(unsigned int value)
+      : v(_mm512_set1_epi32(static_cast<int>(value)))
+  {
+  }
+
   template <>
   TSIMD_INLINE vboolf16::pack(bool32_t value)
   {
@@ -354,6 +434,110 @@ namespace tsimd {
   {
     v = value ? 0xFFFF : 0x0000;
   }
+
+  template <>
+  TSIMD_INLINE maskf<32>::pack(bool32_t value)
+  {
+    v = value ? 0xFFFFFFFF : 0x0;
+  }
+
+  template <>
+  TSIMD_INLINE maskd<32>::pack(bool64_t value)
+  {
+    v = value ? 0xFFFFFFFF : 0x0;
+  }
+
+  template <>
+  TSIMD_INLINE maskf<64>::pack(bool32_t value)
+  {
+    v = value ? ~__mmask64(0) : 0x0;
+  }
+
+  template <>
+  TSIMD_INLINE maskd<64>::pack(bool64_t value)
+  {
+    v = value ? ~__mmask64(0) : 0x0;
+  }
+#endif
+
+  // 8-bit and 16-bit //
+
+#if defined(__SSE4_2__)
+  template <>
+  TSIMD_INLINE vchar16::pack(int8_t value)
+      : v(_mm_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar16::pack(uint8_t value)
+      : v(_mm_set1_epi8(static_cast<char>(value)))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort8::pack(int16_t value)
+      : v(_mm_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort8::pack(uint16_t value)
+      : v(_mm_set1_epi16(static_cast<short>(value)))
+  {
+  }
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+  template <>
+  TSIMD_INLINE vchar32::pack(int8_t value)
+      : v(_mm256_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar32::pack(uint8_t value)
+      : v(_mm256_set1_epi8(static_cast<char>(value)))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort16::pack(int16_t value)
+      : v(_mm256_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort16::pack(uint16_t value)
+      : v(_mm256_set1_epi16(static_cast<short>(value)))
+  {
+  }
+#endif
+
+#if defined(__AVX512BW__)
+  template <>
+  TSIMD_INLINE vchar64::pack(int8_t value)
+      : v(_mm512_set1_epi8(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vuchar64::pack(uint8_t value)
+      : v(_mm512_set1_epi8(static_cast<char>(value)))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vshort32::pack(int16_t value)
+      : v(_mm512_set1_epi16(value))
+  {
+  }
+
+  template <>
+  TSIMD_INLINE vushort32::pack(uint16_t value)
+      : v(_mm512_set1_epi16(static_cast<short>(value)))
+  {
+  }
 #endif
 
   // Generic pack<> members //
@@ -661,6 +845,122 @@ namespace tsimd {
   {
     return bit_iterator((void*)&v, 16);
   }
+
+  // 32-wide //
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 32>::iterator_t
+  pack<bool32_t, 32>::begin()
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 32>::iterator_t
+  pack<bool32_t, 32>::end()
+  {
+    return bit_iterator((void*)&v, 32);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 32>::const_iterator_t
+  pack<bool32_t, 32>::begin() const
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 32>::const_iterator_t
+  pack<bool32_t, 32>::end() const
+  {
+    return bit_iterator((void*)&v, 32);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 32>::iterator_t
+  pack<bool64_t, 32>::begin()
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 32>::iterator_t
+  pack<bool64_t, 32>::end()
+  {
+    return bit_iterator((void*)&v, 32);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 32>::const_iterator_t
+  pack<bool64_t, 32>::begin() const
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 32>::const_iterator_t
+  pack<bool64_t, 32>::end() const
+  {
+    return bit_iterator((void*)&v, 32);
+  }
+
+  // 64-wide //
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 64>::iterator_t
+  pack<bool32_t, 64>::begin()
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 64>::iterator_t
+  pack<bool32_t, 64>::end()
+  {
+    return bit_iterator((void*)&v, 64);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 64>::const_iterator_t
+  pack<bool32_t, 64>::begin() const
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool32_t, 64>::const_iterator_t
+  pack<bool32_t, 64>::end() const
+  {
+    return bit_iterator((void*)&v, 64);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 64>::iterator_t
+  pack<bool64_t, 64>::begin()
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 64>::iterator_t
+  pack<bool64_t, 64>::end()
+  {
+    return bit_iterator((void*)&v, 64);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 64>::const_iterator_t
+  pack<bool64_t, 64>::begin() const
+  {
+    return bit_iterator((void*)&v, 0);
+  }
+
+  template <>
+  TSIMD_INLINE typename pack<bool64_t, 64>::const_iterator_t
+  pack<bool64_t, 64>::end() const
+  {
+    return bit_iterator((void*)&v, 64);
+  }
 #endif
 
   template <typename T, int W>
@@ -732,15 +1032,27 @@ namespace tsimd {
 
   // pack<> cast definition ///////////////////////////////////////////////////
 
+  // NOTE(jda) - Element conversions follow C++ scalar cast semantics, meaning
+  //             floating point --> integer conversions truncate toward zero.
+  //             Native specializations are found in 'convert_elements_to.h'.
+
+  namespace detail {
+    template <typename OTHER_T, typename T, int W>
+    TSIMD_INLINE pack<OTHER_T, W> convert_elements_loop(const pack<T, W> &from)
+    {
+      pack<OTHER_T, W> to;
+
+      for (int i = 0; i < W; ++i)
+        to[i] = from[i];
+
+      return to;
+    }
+  }  // namespace detail
+
   template <typename OTHER_T, typename T, int W>
   TSIMD_INLINE pack<OTHER_T, W> convert_elements_to(const pack<T, W> &from)
   {
-    pack<OTHER_T, W> to;
-
-    for (int i = 0; i < W; ++i)
-      to[i] = from[i];
-
-    return to;
+    return detail::convert_elements_loop<OTHER_T>(from);
   }
 
   template <typename T, int W>
@@ -801,3 +1113,5 @@ namespace tsimd {
   }
 
 }  // namespace tsimd
+
+#include "convert_elements_to.h"
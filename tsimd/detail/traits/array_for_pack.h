@@ -57,6 +57,30 @@ namespace tsimd {
     {
       using type = std::array<__mmask8, 2>;
     };
+
+    template <>
+    struct array_for_pack<bool32_t, 32>
+    {
+      using type = std::array<__mmask8, 4>;
+    };
+
+    template <>
+    struct array_for_pack<bool64_t, 32>
+    {
+      using type = std::array<__mmask8, 4>;
+    };
+
+    template <>
+    struct array_for_pack<bool32_t, 64>
+    {
+      using type = std::array<__mmask8, 8>;
+    };
+
+    template <>
+    struct array_for_pack<bool64_t, 64>
+    {
+      using type = std::array<__mmask8, 8>;
+    };
 #endif
 
 #if defined(__AVX512VL__)
@@ -93,6 +117,30 @@ namespace tsimd {
     {
       using type = std::array<__mmask8, 1>;
     };
+
+    template <>
+    struct half_array_for_pack<bool32_t, 32>
+    {
+      using type = std::array<__mmask8, 2>;
+    };
+
+    template <>
+    struct half_array_for_pack<bool64_t, 32>
+    {
+      using type = std::array<__mmask8, 2>;
+    };
+
+    template <>
+    struct half_array_for_pack<bool32_t, 64>
+    {
+      using type = std::array<__mmask8, 4>;
+    };
+
+    template <>
+    struct half_array_for_pack<bool64_t, 64>
+    {
+      using type = std::array<__mmask8, 4>;
+    };
 #endif
 
   }  // namespace traits
@@ -44,6 +44,46 @@ namespace tsimd {
       using type = bool_undefined_type<T>;
     };
 
+    // 8-bit //
+
+    template <>
+    struct bool_type_for<int8_t>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<uint8_t>
+    {
+      using type = bool8_t;
+    };
+
+    template <>
+    struct bool_type_for<bool8_t>
+    {
+      using type = bool8_t;
+    };
+
+    // 16-bit //
+
+    template <>
+    struct bool_type_for<int16_t>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<uint16_t>
+    {
+      using type = bool16_t;
+    };
+
+    template <>
+    struct bool_type_for<bool16_t>
+    {
+      using type = bool16_t;
+    };
+
     // 32-bit //
 
     template <>
@@ -58,6 +98,12 @@ namespace tsimd {
       using type = bool32_t;
     };
 
+    template <>
+    struct bool_type_for<unsigned int>
+    {
+      using type = bool32_t;
+    };
+
     template <>
     struct bool_type_for<bool32_t>
     {
@@ -57,6 +57,12 @@ namespace tsimd {
       using type = simd_type<float, 1>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 1>
+    {
+      using type = simd_type<float, 1>::type;
+    };
+
     template <>
     struct cast_simd_type<double, 1>
     {
@@ -83,6 +89,12 @@ namespace tsimd {
       using type = simd_type<float, 4>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 4>
+    {
+      using type = simd_type<float, 4>::type;
+    };
+
     template <>
     struct cast_simd_type<bool32_t, 4>
     {
@@ -103,6 +115,12 @@ namespace tsimd {
       using type = simd_type<float, 8>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 8>
+    {
+      using type = simd_type<float, 8>::type;
+    };
+
     template <>
     struct cast_simd_type<bool32_t, 8>
     {
@@ -123,5 +141,11 @@ namespace tsimd {
       using type = simd_type<float, 16>::type;
     };
 
+    template <>
+    struct cast_simd_type<unsigned int, 16>
+    {
+      using type = simd_type<float, 16>::type;
+    };
+
   }  // namespace traits
 }  // namespace tsimd
\ No newline at end of file
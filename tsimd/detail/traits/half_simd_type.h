@@ -67,6 +67,13 @@ namespace tsimd {
       static const bool is_array = false;
     };
 
+    template <>
+    struct half_simd_type<unsigned int, 8>
+    {
+      using type = simd_type<unsigned int, 4>::type;
+      static const bool is_array = false;
+    };
+
     template <>
     struct half_simd_type<bool32_t, 8>
     {
@@ -93,6 +100,13 @@ namespace tsimd {
       using type = simd_type<int, 8>::type;
       static const bool is_array = false;
     };
+
+    template <>
+    struct half_simd_type<unsigned int, 16>
+    {
+      using type = simd_type<unsigned int, 8>::type;
+      static const bool is_array = false;
+    };
 #endif
 
 #if defined(__AVX512F__)
@@ -111,6 +125,178 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__SSE4_2__)
+    template <>
+    struct half_simd_type<int16_t, 16>
+    {
+      using type = simd_type<int16_t, 8>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<uint16_t, 16>
+    {
+      using type = simd_type<uint16_t, 8>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool16_t, 16>
+    {
+      using type = simd_type<bool16_t, 8>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+    // 32-wide //
+
+#if defined(__SSE4_2__)
+    template <>
+    struct half_simd_type<int8_t, 32>
+    {
+      using type = simd_type<int8_t, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<uint8_t, 32>
+    {
+      using type = simd_type<uint8_t, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool8_t, 32>
+    {
+      using type = simd_type<bool8_t, 16>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<int16_t, 32>
+    {
+      using type = simd_type<int16_t, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<uint16_t, 32>
+    {
+      using type = simd_type<uint16_t, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool16_t, 32>
+    {
+      using type = simd_type<bool16_t, 16>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct half_simd_type<float, 32>
+    {
+      using type = simd_type<float, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<int, 32>
+    {
+      using type = simd_type<int, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<unsigned int, 32>
+    {
+      using type = simd_type<unsigned int, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool32_t, 32>
+    {
+      using type = simd_type<bool32_t, 16>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool64_t, 32>
+    {
+      using type = simd_type<bool64_t, 16>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+    // 64-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct half_simd_type<int8_t, 64>
+    {
+      using type = simd_type<int8_t, 32>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<uint8_t, 64>
+    {
+      using type = simd_type<uint8_t, 32>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool8_t, 64>
+    {
+      using type = simd_type<bool8_t, 32>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+#if defined(__AVX512BW__)
+    template <>
+    struct half_simd_type<int16_t, 64>
+    {
+      using type = simd_type<int16_t, 32>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<uint16_t, 64>
+    {
+      using type = simd_type<uint16_t, 32>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool16_t, 64>
+    {
+      using type = simd_type<bool16_t, 32>::type;
+      static const bool is_array = false;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct half_simd_type<bool32_t, 64>
+    {
+      using type = simd_type<bool32_t, 32>::type;
+      static const bool is_array = false;
+    };
+
+    template <>
+    struct half_simd_type<bool64_t, 64>
+    {
+      using type = simd_type<bool64_t, 32>::type;
+      static const bool is_array = false;
+    };
+#endif
+
     // Provide half_simd_type is a std::array<T, W/2> /////////////////////////
 
     template <typename T, int W>
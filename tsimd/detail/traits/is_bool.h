@@ -30,12 +30,13 @@
 namespace tsimd {
   namespace traits {
 
-    // If given type is a bool32_t or bool64_t ////////////////////////////////
+    // If given type is a bool8_t, bool16_t, bool32_t or bool64_t ////////////
 
     template <typename T>
     struct is_bool
     {
       static const bool value =
+          std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, bool64_t>::value;
     };
 
@@ -45,5 +46,15 @@ namespace tsimd {
     template <typename T>
     using is_not_bool_t = enable_if_t<!is_bool<T>::value>;
 
+    template <typename T>
+    struct is_small_bool
+    {
+      static const bool value =
+          std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value;
+    };
+
+    template <typename T>
+    using is_small_bool_t = enable_if_t<is_small_bool<T>::value>;
+
   }  // namespace traits
 }  // namespace tsimd
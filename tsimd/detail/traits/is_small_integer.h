@@ -0,0 +1,61 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+
+#include "enable_if_t.h"
+#include "is_bool.h"
+
+namespace tsimd {
+  namespace traits {
+
+    // If given type is an 8-bit or 16-bit integer type ///////////////////////
+
+    template <typename T>
+    struct is_small_integer
+    {
+      static const bool value =
+          std::is_same<T, int8_t>::value || std::is_same<T, uint8_t>::value ||
+          std::is_same<T, int16_t>::value || std::is_same<T, uint16_t>::value;
+    };
+
+    template <typename T>
+    using is_small_integer_t = enable_if_t<is_small_integer<T>::value>;
+
+    // ...or the matching 8-bit or 16-bit mask type ///////////////////////////
+
+    template <typename T>
+    struct is_small_element
+    {
+      static const bool value =
+          is_small_integer<T>::value || is_small_bool<T>::value;
+    };
+
+    template <typename T>
+    using is_small_element_t = enable_if_t<is_small_element<T>::value>;
+
+  }  // namespace traits
+}  // namespace tsimd
@@ -0,0 +1,61 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include "enable_if_t.h"
+
+namespace tsimd {
+  namespace traits {
+
+    // If pack<T, W> is lowered through two pack<T, W/2> halves ///////////////
+
+    // NOTE(jda) - 32-bit and 64-bit elements (and their masks) have hand
+    //             written overloads for W = 1, 4, 8, and 16, the remaining
+    //             widths (2, 32, and 64) are handled generically by splitting
+    //             them in half until one of those is reached.
+
+    template <typename T, int W>
+    struct is_split_pack
+    {
+      static const bool value = sizeof(T) >= 4 && (W == 2 || W >= 32);
+    };
+
+    template <typename T, int W>
+    using is_split_pack_t = enable_if_t<is_split_pack<T, W>::value>;
+
+    // NOTE(jda) - The split overloads are selected through their return type
+    //             so they don't collide with the existing
+    //             'template <typename T, int W, typename = ...>' overloads.
+
+    template <typename T, int W, typename RESULT_T>
+    using split_pack_result_t =
+        enable_if_t<is_split_pack<T, W>::value, RESULT_T>;
+
+    template <typename T, int W, typename RESULT_T>
+    using unsplit_pack_result_t =
+        enable_if_t<!is_split_pack<T, W>::value, RESULT_T>;
+
+  }  // namespace traits
+}  // namespace tsimd
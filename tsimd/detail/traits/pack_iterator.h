@@ -65,6 +65,30 @@ namespace tsimd {
     {
       using type = bit_iterator;
     };
+
+    template <>
+    struct pack_iterator<bool32_t, 32>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct pack_iterator<bool64_t, 32>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct pack_iterator<bool32_t, 64>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct pack_iterator<bool64_t, 64>
+    {
+      using type = bit_iterator;
+    };
 #endif
 
     template <typename T, int W>
@@ -99,6 +123,30 @@ namespace tsimd {
     {
       using type = bit_iterator;
     };
+
+    template <>
+    struct const_pack_iterator<bool32_t, 32>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct const_pack_iterator<bool64_t, 32>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct const_pack_iterator<bool32_t, 64>
+    {
+      using type = bit_iterator;
+    };
+
+    template <>
+    struct const_pack_iterator<bool64_t, 64>
+    {
+      using type = bit_iterator;
+    };
 #endif
 
   }  // namespace traits
@@ -58,6 +58,18 @@ namespace tsimd {
       using type = typename simd_type<double, W>::type;
     };
 
+    template <int W>
+    struct simd_type<bool8_t, W>
+    {
+      using type = typename simd_type<int8_t, W>::type;
+    };
+
+    template <int W>
+    struct simd_type<bool16_t, W>
+    {
+      using type = typename simd_type<int16_t, W>::type;
+    };
+
     // 1-wide //
 
     template <>
@@ -72,6 +84,12 @@ namespace tsimd {
       using type = int;
     };
 
+    template <>
+    struct simd_type<unsigned int, 1>
+    {
+      using type = unsigned int;
+    };
+
     template <>
     struct simd_type<double, 1>
     {
@@ -84,6 +102,46 @@ namespace tsimd {
       using type = long long;
     };
 
+    template <>
+    struct simd_type<int8_t, 1>
+    {
+      using type = int8_t;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 1>
+    {
+      using type = uint8_t;
+    };
+
+    template <>
+    struct simd_type<int16_t, 1>
+    {
+      using type = int16_t;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 1>
+    {
+      using type = uint16_t;
+    };
+
+    // 2-wide //
+
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_type<double, 2>
+    {
+      using type = __m128d;
+    };
+
+    template <>
+    struct simd_type<long long, 2>
+    {
+      using type = __m128i;
+    };
+#endif
+
     // 4-wide //
 
 #if defined(__SSE4_2__)
@@ -98,6 +156,12 @@ namespace tsimd {
     {
       using type = __m128i;
     };
+
+    template <>
+    struct simd_type<unsigned int, 4>
+    {
+      using type = __m128i;
+    };
 #endif
 
 #if defined(__AVX2__) || defined(__AVX__)
@@ -130,6 +194,26 @@ namespace tsimd {
     {
       using type = __m256i;
     };
+
+    template <>
+    struct simd_type<unsigned int, 8>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_type<int16_t, 8>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 8>
+    {
+      using type = __m128i;
+    };
 #endif
 
 #if defined(__AVX512F__)
@@ -175,6 +259,12 @@ namespace tsimd {
       using type = __m512i;
     };
 
+    template <>
+    struct simd_type<unsigned int, 16>
+    {
+      using type = __m512i;
+    };
+
     template <>
     struct simd_type<bool32_t, 16>
     {
@@ -188,6 +278,108 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_type<int8_t, 16>
+    {
+      using type = __m128i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 16>
+    {
+      using type = __m128i;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<int16_t, 16>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 16>
+    {
+      using type = __m256i;
+    };
+#endif
+
+    // 32-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_type<int8_t, 32>
+    {
+      using type = __m256i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 32>
+    {
+      using type = __m256i;
+    };
+#endif
+
+#if defined(__AVX512BW__)
+    template <>
+    struct simd_type<int16_t, 32>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<uint16_t, 32>
+    {
+      using type = __m512i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<bool32_t, 32>
+    {
+      using type = __mmask32;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 32>
+    {
+      using type = __mmask32;
+    };
+#endif
+
+    // 64-wide //
+
+#if defined(__AVX512BW__)
+    template <>
+    struct simd_type<int8_t, 64>
+    {
+      using type = __m512i;
+    };
+
+    template <>
+    struct simd_type<uint8_t, 64>
+    {
+      using type = __m512i;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_type<bool32_t, 64>
+    {
+      using type = __mmask64;
+    };
+
+    template <>
+    struct simd_type<bool64_t, 64>
+    {
+      using type = __mmask64;
+    };
+#endif
+
     // Check if a pack<T, W>::intrinsic_t is actually an intrinsic type ///////
 
     // example: pack<float, 8> on AVX is type __m256, so evaluate to "true"
@@ -216,6 +408,28 @@ namespace tsimd {
       using type = typename array_for_pack<T, W>::type;
     };
 
+    // 2-wide //
+
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_or_array_type<double, 2>
+    {
+      using type = typename simd_type<double, 2>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<long long, 2>
+    {
+      using type = typename simd_type<long long, 2>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool64_t, 2>
+    {
+      using type = typename simd_type<bool64_t, 2>::type;
+    };
+#endif
+
     // 4-wide //
 
 #if defined(__SSE4_2__)
@@ -230,6 +444,12 @@ namespace tsimd {
     {
       using type = typename simd_type<int, 4>::type;
     };
+
+    template <>
+    struct simd_or_array_type<unsigned int, 4>
+    {
+      using type = typename simd_type<unsigned int, 4>::type;
+    };
 #endif
 
 #if defined(__AVX2__) || defined(__AVX__)
@@ -263,6 +483,12 @@ namespace tsimd {
       using type = typename simd_type<int, 8>::type;
     };
 
+    template <>
+    struct simd_or_array_type<unsigned int, 8>
+    {
+      using type = typename simd_type<unsigned int, 8>::type;
+    };
+
     template <>
     struct simd_or_array_type<bool32_t, 8>
     {
@@ -270,6 +496,26 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_or_array_type<int16_t, 8>
+    {
+      using type = typename simd_type<int16_t, 8>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint16_t, 8>
+    {
+      using type = typename simd_type<uint16_t, 8>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool16_t, 8>
+    {
+      using type = typename simd_type<bool16_t, 8>::type;
+    };
+#endif
+
 #if defined(__AVX512F__)
     template <>
     struct simd_or_array_type<double, 8>
@@ -305,6 +551,12 @@ namespace tsimd {
       using type = typename simd_type<int, 16>::type;
     };
 
+    template <>
+    struct simd_or_array_type<unsigned int, 16>
+    {
+      using type = typename simd_type<unsigned int, 16>::type;
+    };
+
     template <>
     struct simd_or_array_type<bool32_t, 16>
     {
@@ -318,5 +570,137 @@ namespace tsimd {
     };
 #endif
 
+#if defined(__SSE4_2__)
+    template <>
+    struct simd_or_array_type<int8_t, 16>
+    {
+      using type = typename simd_type<int8_t, 16>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint8_t, 16>
+    {
+      using type = typename simd_type<uint8_t, 16>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool8_t, 16>
+    {
+      using type = typename simd_type<bool8_t, 16>::type;
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_or_array_type<int16_t, 16>
+    {
+      using type = typename simd_type<int16_t, 16>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint16_t, 16>
+    {
+      using type = typename simd_type<uint16_t, 16>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool16_t, 16>
+    {
+      using type = typename simd_type<bool16_t, 16>::type;
+    };
+#endif
+
+    // 32-wide //
+
+#if defined(__AVX2__) || defined(__AVX__)
+    template <>
+    struct simd_or_array_type<int8_t, 32>
+    {
+      using type = typename simd_type<int8_t, 32>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint8_t, 32>
+    {
+      using type = typename simd_type<uint8_t, 32>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool8_t, 32>
+    {
+      using type = typename simd_type<bool8_t, 32>::type;
+    };
+#endif
+
+#if defined(__AVX512BW__)
+    template <>
+    struct simd_or_array_type<int16_t, 32>
+    {
+      using type = typename simd_type<int16_t, 32>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint16_t, 32>
+    {
+      using type = typename simd_type<uint16_t, 32>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool16_t, 32>
+    {
+      using type = typename simd_type<bool16_t, 32>::type;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_or_array_type<bool32_t, 32>
+    {
+      using type = typename simd_type<bool32_t, 32>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool64_t, 32>
+    {
+      using type = typename simd_type<bool64_t, 32>::type;
+    };
+#endif
+
+    // 64-wide //
+
+#if defined(__AVX512BW__)
+    template <>
+    struct simd_or_array_type<int8_t, 64>
+    {
+      using type = typename simd_type<int8_t, 64>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<uint8_t, 64>
+    {
+      using type = typename simd_type<uint8_t, 64>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool8_t, 64>
+    {
+      using type = typename simd_type<bool8_t, 64>::type;
+    };
+#endif
+
+#if defined(__AVX512F__)
+    template <>
+    struct simd_or_array_type<bool32_t, 64>
+    {
+      using type = typename simd_type<bool32_t, 64>::type;
+    };
+
+    template <>
+    struct simd_or_array_type<bool64_t, 64>
+    {
+      using type = typename simd_type<bool64_t, 64>::type;
+    };
+#endif
+
   }  // namespace traits
 }  // namespace tsimd
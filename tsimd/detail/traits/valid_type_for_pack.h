@@ -26,6 +26,7 @@
 
 #include "../utility/bool_t.h"
 #include "enable_if_t.h"
+#include "is_small_integer.h"
 
 namespace tsimd {
   namespace traits {
@@ -37,8 +38,11 @@ namespace tsimd {
     {
       static const bool value =
           std::is_same<T, float>::value || std::is_same<T, int>::value ||
+          std::is_same<T, unsigned int>::value ||
           std::is_same<T, bool32_t>::value || std::is_same<T, double>::value ||
-          std::is_same<T, long long>::value || std::is_same<T, bool64_t>::value;
+          std::is_same<T, long long>::value ||
+          std::is_same<T, bool64_t>::value || is_small_integer<T>::value ||
+          std::is_same<T, bool8_t>::value || std::is_same<T, bool16_t>::value;
     };
 
     template <typename T>
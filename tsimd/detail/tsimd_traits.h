@@ -38,6 +38,9 @@
 #include "traits/is_n_bytes.h"
 #include "traits/is_pack_of_width.h"
 #include "traits/is_pack.h"
+#include "traits/is_small_integer.h"
+#include "traits/is_split_pack.h"
+#include "traits/is_wide_integer.h"
 #include "traits/is_same_t.h"
 #include "traits/pack_iterator.h"
 #include "traits/same_size.h"
@@ -91,9 +91,9 @@ namespace tsimd {
   {
     auto &val = *storage;
     if (bit_value)
-      val |= (1u << lane) & 0xFFFFFFFFFFFFFFFFLL;
+      val |= size_t(1) << lane;
     else
-      val &= (1u << lane) ^ 0xFFFFFFFFFFFFFFFFLL;
+      val &= ~(size_t(1) << lane);
     return *this;
   }
 
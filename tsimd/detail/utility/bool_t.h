@@ -28,6 +28,136 @@
 
 namespace tsimd {
 
+  // 8-bit bool type //////////////////////////////////////////////////////////
+
+  // NOTE: this type is to be used for the per-element 8-bit SIMD mask types
+  struct bool8_t
+  {
+    bool8_t()                = default;
+    bool8_t(const bool8_t &) = default;
+    bool8_t(bool8_t &&)      = default;
+    bool8_t &operator=(const bool8_t &) = default;
+    bool8_t &operator=(bool8_t &&) = default;
+
+    TSIMD_INLINE bool8_t(bool b) noexcept
+    {
+      // opt: if b is 0/1, the same result can be gotten by 'value = -b'
+      value = b ? 0xFF : 0x0;
+    }
+
+    TSIMD_INLINE bool8_t &operator=(bool b) noexcept
+    {
+      // opt: if b is 0/1, the same result can be gotten by 'value = -b'
+      value = b ? 0xFF : 0x0;
+      return *this;
+    }
+
+    TSIMD_INLINE operator bool() const noexcept
+    {
+      return value == 0xFF;
+    }
+
+    uint8_t value;
+  };
+
+  // Inlined operators ////////////////////////////////////////////////////////
+
+  TSIMD_INLINE bool8_t operator!(const bool8_t &p1)
+  {
+    return !p1.value;
+  }
+
+  TSIMD_INLINE bool8_t operator|(const bool8_t &p1, const bool8_t &p2)
+  {
+    return p1.value | p2.value;
+  }
+
+  TSIMD_INLINE bool8_t operator&(const bool8_t &p1, const bool8_t &p2)
+  {
+    return p1.value & p2.value;
+  }
+
+  TSIMD_INLINE bool8_t operator^(const bool8_t &p1, const bool8_t &p2)
+  {
+    return p1.value ^ p2.value;
+  }
+
+  TSIMD_INLINE bool8_t operator==(const bool8_t &p1, const bool8_t &p2)
+  {
+    return p1.value == p2.value;
+  }
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const bool8_t &v)
+  {
+    o << static_cast<bool>(v);
+    return o;
+  }
+
+  // 16-bit bool type /////////////////////////////////////////////////////////
+
+  // NOTE: this type is to be used for the per-element 16-bit SIMD mask types
+  struct bool16_t
+  {
+    bool16_t()                 = default;
+    bool16_t(const bool16_t &) = default;
+    bool16_t(bool16_t &&)      = default;
+    bool16_t &operator=(const bool16_t &) = default;
+    bool16_t &operator=(bool16_t &&) = default;
+
+    TSIMD_INLINE bool16_t(bool b) noexcept
+    {
+      // opt: if b is 0/1, the same result can be gotten by 'value = -b'
+      value = b ? 0xFFFF : 0x0;
+    }
+
+    TSIMD_INLINE bool16_t &operator=(bool b) noexcept
+    {
+      // opt: if b is 0/1, the same result can be gotten by 'value = -b'
+      value = b ? 0xFFFF : 0x0;
+      return *this;
+    }
+
+    TSIMD_INLINE operator bool() const noexcept
+    {
+      return value == 0xFFFF;
+    }
+
+    uint16_t value;
+  };
+
+  // Inlined operators ////////////////////////////////////////////////////////
+
+  TSIMD_INLINE bool16_t operator!(const bool16_t &p1)
+  {
+    return !p1.value;
+  }
+
+  TSIMD_INLINE bool16_t operator|(const bool16_t &p1, const bool16_t &p2)
+  {
+    return p1.value | p2.value;
+  }
+
+  TSIMD_INLINE bool16_t operator&(const bool16_t &p1, const bool16_t &p2)
+  {
+    return p1.value & p2.value;
+  }
+
+  TSIMD_INLINE bool16_t operator^(const bool16_t &p1, const bool16_t &p2)
+  {
+    return p1.value ^ p2.value;
+  }
+
+  TSIMD_INLINE bool16_t operator==(const bool16_t &p1, const bool16_t &p2)
+  {
+    return p1.value == p2.value;
+  }
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const bool16_t &v)
+  {
+    o << static_cast<bool>(v);
+    return o;
+  }
+
   // 32-bit bool type /////////////////////////////////////////////////////////
 
   // NOTE: this type is to be used for the per-element 32-bit SIMD mask types
@@ -0,0 +1,141 @@
+// ========================================================================== //
+// The MIT License (MIT)                                                      //
+//                                                                            //
+// Copyright (c) 2017 Intel Corporation                                       //
+//                                                                            //
+// Permission is hereby granted, free of charge, to any person obtaining a    //
+// copy of this software and associated documentation files (the "Software"), //
+// to deal in the Software without restriction, including without limitation  //
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,   //
+// and/or sell copies of the Software, and to permit persons to whom the      //
+// Software is furnished to do so, subject to the following conditions:       //
+//                                                                            //
+// The above copyright notice and this permission notice shall be included in //
+// in all copies or substantial portions of the Software.                     //
+//                                                                            //
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR //
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,   //
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL    //
+// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER //
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING    //
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER        //
+// DEALINGS IN THE SOFTWARE.                                                  //
+// ========================================================================== //
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+
+#include "../config.h"
+
+namespace tsimd {
+
+  namespace detail {
+
+    // NOTE(jda) - Scalar IEEE binary16 <-> binary32 conversions, used when
+    //             F16C isn't available. Rounding is round-to-nearest-even,
+    //             matching _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT).
+
+    TSIMD_INLINE uint32_t float_as_bits(float f)
+    {
+      uint32_t bits;
+      std::memcpy(&bits, &f, sizeof(bits));
+      return bits;
+    }
+
+    TSIMD_INLINE float bits_as_float(uint32_t bits)
+    {
+      float f;
+      std::memcpy(&f, &bits, sizeof(f));
+      return f;
+    }
+
+    TSIMD_INLINE uint16_t float_to_half_bits(float f)
+    {
+#if defined(__F16C__)
+      return _cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT);
+#else
+      uint32_t x          = float_as_bits(f);
+      const uint32_t sign = (x >> 16) & 0x8000;
+
+      x &= 0x7FFFFFFF;
+
+      if (x >= 0x7F800000) {
+        // inf stays inf, NaN stays (quiet) NaN
+        const uint32_t nan = x > 0x7F800000 ? 0x200 | (x >> 13) : 0;
+        return static_cast<uint16_t>(sign | 0x7C00 | (nan & 0x3FF));
+      } else if (x >= 0x477FF000) {
+        // rounds to a value >= 65520, which overflows to inf
+        return static_cast<uint16_t>(sign | 0x7C00);
+      } else if (x < 0x38800000) {
+        // half subnormal (or zero): adding 0.5f lines the half ulp (2^-24)
+        // up with the float ulp, so the FPU does the rounding for us
+        const float rounded = bits_as_float(x) + 0.5f;
+        return static_cast<uint16_t>(
+            sign | (float_as_bits(rounded) - float_as_bits(0.5f)));
+      } else {
+        // rebias the exponent and round the mantissa to nearest even
+        const uint32_t odd = (x >> 13) & 1;
+        x += 0xC8000FFF + odd;
+        return static_cast<uint16_t>(sign | (x >> 13));
+      }
+#endif
+    }
+
+    TSIMD_INLINE float half_bits_to_float(uint16_t h)
+    {
+#if defined(__F16C__)
+      return _cvtsh_ss(h);
+#else
+      const uint32_t sign = uint32_t(h & 0x8000) << 16;
+      const uint32_t exp  = (h >> 10) & 0x1F;
+      const uint32_t mant = h & 0x3FF;
+
+      if (exp == 0x1F)
+        return bits_as_float(sign | 0x7F800000 | (mant << 13));
+      else if (exp == 0)
+        return bits_as_float(sign | float_as_bits(mant * 5.9604645e-8f));
+      else
+        return bits_as_float(sign | ((exp + 112) << 23) | (mant << 13));
+#endif
+    }
+
+  }  // namespace detail
+
+  // 16-bit floating point storage type ///////////////////////////////////////
+
+  // NOTE: this type is only meant for storing data in memory, there are no
+  //       pack<half, W> types: load(const half *) and store(vfloat, half *)
+  //       convert to and from float, where all arithmetic is done.
+  struct half
+  {
+    half()             = default;
+    half(const half &) = default;
+    half(half &&)      = default;
+    half &operator=(const half &) = default;
+    half &operator=(half &&) = default;
+
+    TSIMD_INLINE explicit half(float f) noexcept
+        : bits(detail::float_to_half_bits(f))
+    {
+    }
+
+    TSIMD_INLINE operator float() const noexcept
+    {
+      return detail::half_bits_to_float(bits);
+    }
+
+    uint16_t bits;
+  };
+
+  static_assert(sizeof(half) == 2, "half must be 2 bytes!");
+
+  TSIMD_INLINE std::ostream &operator<<(std::ostream &o, const half &v)
+  {
+    o << static_cast<float>(v);
+    return o;
+  }
+
+}  // namespace tsimd
@@ -26,10 +26,13 @@
 
 #include "detail/pack.h"
 
+#include "detail/cpu.h"
+
 #include "detail/functions/algorithm.h"
 #include "detail/functions/math.h"
 #include "detail/functions/memory.h"
 #include "detail/functions/random.h"
+#include "detail/functions/shuffle.h"
 
 #include "detail/operators/arithmetic.h"
 #include "detail/operators/bitwise.h"